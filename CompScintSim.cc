@@ -49,16 +49,23 @@
 #include "CompScintSimGDMLDetectorConstruction.hh"
 #endif
 #include "CompScintSimActionInitialization.hh"
-#include "FTFP_BERT.hh"
-#include "G4EmStandardPhysics_option4.hh"
-#include "G4OpticalPhysics.hh"
+#include "CompScintSimPhysicsList.hh"
+#include "CompScintSimWorkerInitialization.hh"
 #include "G4RunManagerFactory.hh"
+#ifdef G4MULTITHREADED
+#include "G4MTRunManager.hh"
+#endif
 #include "G4Types.hh"
 #include "G4UIExecutive.hh"
 #include "G4UImanager.hh"
 #include "G4VisExecutive.hh"
 #include "G4Scintillation.hh"
 
+#include "EventSeeder.hh"
+#include "ScintillatorLayerManager.hh"
+#include "StartupBenchmark.hh"
+#include "ThreadPinning.hh"
+
 #include "config.hh"
 #include "utilities.hh"
 
@@ -70,13 +77,25 @@ namespace
     G4cerr << " Usage: " << G4endl;
 #ifdef GEANT4_USE_GDML
     G4cerr << " CompScintSim [-g gdmlfile] [-m macro ] [-u UIsession] [-t "
-              "nThreads] [-r seed] [-debug]"
+              "nThreads] [-r seed] [-physics preset] [-runManager type] "
+              "[-eventsPerTask N] [-seedOnce mode] [-pin policy] [-batch] [-debug]"
            << G4endl;
 #else
-    G4cerr << " CompScintSim  [-m macro ] [-u UIsession] [-t nThreads] [-r seed] [-debug]"
+    G4cerr << " CompScintSim  [-m macro ] [-u UIsession] [-t nThreads] [-r seed] [-physics preset] "
+              "[-runManager type] [-eventsPerTask N] [-seedOnce mode] [-pin policy] [-batch] [-debug]"
            << G4endl;
 #endif
-    G4cerr << "   note: -t option is available only for multi-threaded mode." << G4endl;
+    G4cerr << "   note: -t, -eventsPerTask, -seedOnce and -pin are available only for multi-threaded mode." << G4endl;
+    G4cerr << "   note: -pin is none, compact, scatter or a core list like 0,2,4-7." << G4endl;
+    G4cerr << "   note: -r is a 64-bit run seed (decimal or 0x hex); every event is seeded from it,"
+              " so results do not depend on -t or -runManager." << G4endl;
+    G4cerr << "   note: -runManager is Serial, MT, Tasking or Default; -eventsPerTask and -seedOnce (0, 1 or 2)"
+              " are the same as /run/eventModulo." << G4endl;
+    G4cerr << "   note: -physics takes comma separated items: em0|em3|em4|livermore, "
+              "hadronic|nohadronic, optical|nooptical (default em4,hadronic)," << G4endl;
+    G4cerr << "         and optical processes [no]scintillation|[no]cerenkov|[no]absorption|"
+              "[no]rayleigh|[no]wls (default nocerenkov)." << G4endl;
+    G4cerr << "   note: -batch (with -m) skips the visualization manager for a fast start." << G4endl;
     G4cerr << "   note: -debug enables detailed log output including DEBUG level messages." << G4endl;
   }
 } // namespace
@@ -86,21 +105,20 @@ namespace
 int main(int argc, char **argv)
 {
   // Evaluate arguments
+  // 参数个数不设上限，未知的选项和缺少值的选项由下面的解析拒绝
   //
-  if (argc > 10) // 增加最大参数数量以支持-debug
-  {
-    PrintUsage();
-    return 1;
-  }
   G4String gdmlfile = "";
+  G4String physicsPreset;
   G4String macro;
   G4String session;
+  G4bool batch = false;
+  G4String runManagerType = "Default";
 #ifdef G4MULTITHREADED
   G4int nThreads = 0;
+  G4int eventsPerTask = 0; // 0表示由运行管理器决定
+  G4int seedOnce = -1;     // -1表示使用运行管理器的默认值
 #endif
 
-  // G4long myseed = 345354; # 固定种子
-  G4long myseed = time(0); // 随机种子
   for (G4int i = 1; i < argc; i++)
   {
     if (G4String(argv[i]) == "-debug")
@@ -109,6 +127,11 @@ int main(int argc, char **argv)
       g_debug_mode = true;
       continue; // 跳过当前参数，继续处理下一个
     }
+    if (G4String(argv[i]) == "-batch")
+    {
+      batch = true;
+      continue;
+    }
     
     // 检查是否还有足够的参数（需要成对处理）
     if (i + 1 >= argc)
@@ -124,12 +147,31 @@ int main(int argc, char **argv)
     else if (G4String(argv[i]) == "-u")
       session = argv[i + 1];
     else if (G4String(argv[i]) == "-r")
-      myseed = atoi(argv[i + 1]);
+    {
+      // 64位run种子，各事件的种子由其派生（EventSeeder），未给出时取当前时间
+      std::uint64_t seed = 0;
+      if (!EventSeeder::ParseSeed(argv[i + 1], seed))
+      {
+        PrintUsage();
+        return 1;
+      }
+      EventSeeder::SetRunSeed(seed);
+    }
+    else if (G4String(argv[i]) == "-physics")
+      physicsPreset = argv[i + 1];
+    else if (G4String(argv[i]) == "-runManager")
+      runManagerType = argv[i + 1];
 #ifdef G4MULTITHREADED
     else if (G4String(argv[i]) == "-t")
     {
       nThreads = G4UIcommand::ConvertToInt(argv[i + 1]);
     }
+    else if (G4String(argv[i]) == "-eventsPerTask")
+      eventsPerTask = G4UIcommand::ConvertToInt(argv[i + 1]);
+    else if (G4String(argv[i]) == "-seedOnce")
+      seedOnce = G4UIcommand::ConvertToInt(argv[i + 1]);
+    else if (G4String(argv[i]) == "-pin")
+      ThreadPinning::SetPolicy(argv[i + 1]);
 #endif
     else
     {
@@ -141,8 +183,22 @@ int main(int argc, char **argv)
     i++;
   }
   
-  // 日志级别会根据g_debug_mode自动设置
-  
+  // -batch只用于执行宏文件
+  if (batch && macro.empty())
+  {
+    PrintUsage();
+    return 1;
+  }
+  if (runManagerType != "Serial" && runManagerType != "MT" && runManagerType != "Tasking" &&
+      runManagerType != "Default")
+  {
+    PrintUsage();
+    return 1;
+  }
+
+  // 根据g_debug_mode设置日志级别（必须在解析-debug之后）
+  InitializeLogLevel();
+
   myPrint(INFO, "Starting CompScintSim application...");
   if (g_debug_mode) {
     myPrint(DEBUG, "调试模式已启用 (g_debug_mode = true)，将显示所有DEBUG级别信息");
@@ -151,6 +207,9 @@ int main(int argc, char **argv)
     myPrint(DEBUG, "提示: 使用 -debug 命令行参数可启用详细调试输出");
   }
 
+  // 层参数在主线程中读取一次，各线程只读取其快照（ScintillatorLayerManager::GetSnapshot）
+  ScintillatorLayerManager::GetInstance().Initialize(g_ScintillatorGeometry);
+
   // Instantiate G4UIExecutive if interactive mode
   G4UIExecutive *ui = nullptr;
   if (macro.size() == 0)
@@ -158,15 +217,30 @@ int main(int argc, char **argv)
     ui = new G4UIExecutive(argc, argv);
   }
 
-  // Construct the default run manager
-  auto runManager = G4RunManagerFactory::CreateRunManager();
+  // 记录启动各阶段的耗时与内存，第一个run结束时输出，由G4StateManager负责删除
+  new StartupBenchmark();
+
+  // Construct the run manager，事件耗时差别大时用Tasking按块动态分配事件
+  auto runManager = G4RunManagerFactory::CreateRunManager(G4RunManagerFactory::GetType(runManagerType));
 #ifdef G4MULTITHREADED
   if (nThreads > 0)
     runManager->SetNumberOfThreads(nThreads);
+
+  // 每次分配给线程的事件数和随机数种子的生成方式，宏中可用 /run/eventModulo <N> <seedOnce> 修改
+  if (auto mtRunManager = dynamic_cast<G4MTRunManager *>(runManager))
+  {
+    if (eventsPerTask > 0)
+      mtRunManager->SetEventModulo(eventsPerTask);
+    if (seedOnce >= 0)
+      mtRunManager->SetSeedOncePerCommunication(seedOnce);
+  }
+
+  // 工作线程在创建线程状态之前按-pin或/MySim/pinThreads的策略绑定到核
+  runManager->SetUserInitialization(new CompScintSimWorkerInitialization());
 #endif
 
-  // Seed the random number generator manually
-  G4Random::setTheSeed(myseed);
+  // 主线程的引擎也由run种子设置；事件开始时各线程的引擎按事件种子重新设置
+  G4Random::setTheSeed(static_cast<long>(EventSeeder::GetRunSeed() & 0x7FFFFFFF));
 
   // Set mandatory initialization classes
   //
@@ -186,22 +260,18 @@ int main(int argc, char **argv)
   {
     runManager->SetUserInitialization(new CompScintSimDetectorConstruction());
   }
-  // Physics list
-  G4VModularPhysicsList *physicsList = new FTFP_BERT;
-  physicsList->ReplacePhysics(new G4EmStandardPhysics_option4());
-
-  if (g_has_opticalPhysics)
-  {
-    G4OpticalPhysics *opticalPhysics = new G4OpticalPhysics();
-    physicsList->RegisterPhysics(opticalPhysics);
-  }
-
-  runManager->SetUserInitialization(physicsList);
+  // Physics list，由-physics选择预设，默认与FTFP_BERT + G4EmStandardPhysics_option4相同
+  runManager->SetUserInitialization(new CompScintSimPhysicsList(physicsPreset));
 
   runManager->SetUserInitialization(new CompScintSimActionInitialization());
 
-  G4VisManager *visManager = new G4VisExecutive("Quiet");
-  visManager->Initialize();
+  // 批处理模式不需要可视化，不构建可视化管理器和图形驱动
+  G4VisManager *visManager = nullptr;
+  if (!batch)
+  {
+    visManager = new G4VisExecutive("Quiet");
+    visManager->Initialize();
+  }
 
   G4UImanager *UImanager = G4UImanager::GetUIpointer();
 
@@ -223,6 +293,8 @@ int main(int argc, char **argv)
   delete visManager;
   delete runManager;
 
+  FlushLog();
+
   return 0;
 }
 
@@ -487,7 +487,7 @@ class MacFileGenerator:
         gps_mode (str): 使用的GPS命令模式 ('custom' 或 'native')
     """
     
-    def __init__(self, spectrum, num_events=10, verbose_level=0, root_file=None):
+    def __init__(self, spectrum, num_events=10, verbose_level=0, root_file=None, physics_cache=None):
         """
         初始化MAC文件生成器
         
@@ -496,6 +496,7 @@ class MacFileGenerator:
             num_events (int, optional): 模拟事件数，默认为10
             verbose_level (int, optional): 详细输出级别，默认为0
             root_file (str, optional): Root文件保存路径 (不含扩展名)
+            physics_cache (str, optional): 物理表缓存目录，相同配置的后续运行直接读取物理表
         """
         if spectrum is None:
             raise ValueError("MacFileGenerator 需要一个 EnergySpectrum 对象")
@@ -504,6 +505,7 @@ class MacFileGenerator:
         self.num_events = num_events
         self.verbose_level = verbose_level
         self.root_file = root_file # Path without extension
+        self.physics_cache = physics_cache
         self.gps_mode = spectrum.gps_mode # Inherit mode from spectrum
     
     def generate_mac_file(self, output_path="radiation_field.mac"):
@@ -526,7 +528,10 @@ class MacFileGenerator:
 /run/verbose {self.verbose_level}
 /tracking/verbose {self.verbose_level}
 /control/cout/ignoreThreadsExcept 0
-/run/initialize
+"""
+        if self.physics_cache:
+            mac_content += f"/CompScintSim/physics/tableCache {self.physics_cache}\n"
+        mac_content += """/run/initialize
 
 # Set Output Root File Name (if provided)
 """
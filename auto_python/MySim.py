@@ -20,6 +20,7 @@ rel_dir_root = r'./Data/RawData/'  # ROOT files directory
 rel_dir_csv  = r'./Data/CSVData/'  # CSV output directory
 rel_dir_mac  = r'./Data/MacLog/'   # MAC files directory
 rel_dir_log  = r'./Data/RunLog/'   # Simulation log directory
+rel_dir_physics_cache = r'./Data/PhysicsCache/' # Physics table cache directory
 rel_dir_geant4_executable = r'../build/CompScintSim' # Geant4 executable relative path
 
 # 获取绝对路径，末尾加上 '/'. 使用 os.path.normpath 确保路径格式一致
@@ -27,6 +28,7 @@ abs_dir_root   = os.path.normpath(os.path.join(current_path, rel_dir_root)) + os
 abs_dir_csv    = os.path.normpath(os.path.join(current_path, rel_dir_csv)) + os.sep
 abs_dir_mac    = os.path.normpath(os.path.join(current_path, rel_dir_mac)) + os.sep
 abs_dir_log    = os.path.normpath(os.path.join(current_path, rel_dir_log)) + os.sep
+abs_dir_physics_cache = os.path.normpath(os.path.join(current_path, rel_dir_physics_cache)) + os.sep
 abs_dir_geant4_executable = os.path.normpath(os.path.join(current_path, rel_dir_geant4_executable))
 
 class MySim:
@@ -65,7 +67,8 @@ class MySim:
             spectrum=self.spectrum,
             num_events=self.num_events,
             verbose_level=0, # Default verbose level
-            root_file=self.root_file # Pass the path without .root extension
+            root_file=self.root_file, # Pass the path without .root extension
+            physics_cache=abs_dir_physics_cache # 同一配置的各次运行共用物理表
         )
 
     @classmethod
@@ -0,0 +1,79 @@
+"""
+物理预设的速度与偏差对比
+
+在项目根目录中依次以各预设运行 mac/bench_physics.mac，
+汇总每种粒子的 Events/s 和各层平均沉积能量相对于参考预设的最大偏差，输出markdown表格。
+
+用法：
+    python bench_physics.py [项目根目录] [预设 ...]
+"""
+import csv
+import os
+import re
+import subprocess
+import sys
+
+PARTICLES = ['e-', 'proton', 'gamma']
+REFERENCE = 'em4,hadronic'
+DEFAULT_PRESETS = [REFERENCE, 'em3,hadronic', 'em0,hadronic', 'livermore,hadronic', 'em4,nohadronic', 'em0,nohadronic']
+
+
+def run_preset(root_dir, preset):
+    """以一个预设运行基准宏，返回各粒子的 Events/s"""
+    tag = preset.replace(',', '_')
+    wrapper = os.path.join(root_dir, f'bench_physics_{tag}.mac')
+    with open(wrapper, 'w') as f:
+        f.write(f'/control/alias tag {tag}\n/control/execute mac/bench_physics.mac\n')
+    result = subprocess.run(['./build/CompScintSim', '-m', os.path.basename(wrapper), '-physics', preset],
+                            cwd=root_dir, capture_output=True, text=True)
+    os.remove(wrapper)
+    if result.returncode != 0:
+        raise RuntimeError(f'{preset} failed:\n{result.stdout[-2000:]}\n{result.stderr[-2000:]}')
+    rates = [float(x) for x in re.findall(r'Events/s: ([0-9.eE+-]+)', result.stdout)]
+    return tag, dict(zip(PARTICLES, rates))
+
+
+def layer_means(file_name):
+    """合并后的CSV：表头为各层copynumber和weight，返回各层的加权平均沉积能量"""
+    with open(file_name) as f:
+        reader = csv.reader(f)
+        header = next(reader)
+        sums = [0.] * (len(header) - 1)
+        total_weight = 0.
+        for row in reader:
+            weight = float(row[-1])
+            total_weight += weight
+            for i, value in enumerate(row[:-1]):
+                sums[i] += weight * float(value)
+    return [s / total_weight if total_weight > 0 else 0. for s in sums]
+
+
+def main():
+    root_dir = os.path.abspath(sys.argv[1] if len(sys.argv) > 1 else '..')
+    presets = sys.argv[2:] or DEFAULT_PRESETS
+    if REFERENCE not in presets:
+        presets = [REFERENCE] + presets
+
+    results = {}
+    for preset in presets:
+        print(f'running {preset} ...', file=sys.stderr)
+        results[preset] = run_preset(root_dir, preset)
+
+    ref_tag = results[REFERENCE][0]
+    print('| preset | ' + ' | '.join(f'{p} events/s | {p} max bias' for p in PARTICLES) + ' |')
+    print('|---' * (1 + 2 * len(PARTICLES)) + '|')
+    for preset in presets:
+        tag, rates = results[preset]
+        cells = []
+        for particle in PARTICLES:
+            ref = layer_means(os.path.join(root_dir, f'bench_{ref_tag}_{particle}.csv'))
+            cur = layer_means(os.path.join(root_dir, f'bench_{tag}_{particle}.csv'))
+            # 只统计平均沉积能量不为0的层
+            bias = max((abs(c / r - 1.) for c, r in zip(cur, ref) if r > 0), default=0.)
+            cells.append(f'{rates.get(particle, 0.):.1f}')
+            cells.append(f'{100 * bias:.2f}%')
+        print(f'| {preset} | ' + ' | '.join(cells) + ' |')
+
+
+if __name__ == '__main__':
+    main()
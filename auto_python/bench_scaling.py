@@ -0,0 +1,52 @@
+"""
+线程扩展性与线程绑定的对比
+
+在项目根目录中以不同的线程数和绑定策略（-pin）运行同一个宏，
+汇总每次运行输出的 Events/s，输出markdown表格（多个run时取平均）。
+
+用法：
+    python bench_scaling.py [宏文件] [线程数 ...]
+例如：
+    python bench_scaling.py mac/single_particle.mac 1 2 4 8 16 32 64
+"""
+import os
+import re
+import subprocess
+import sys
+
+POLICIES = ['none', 'compact', 'scatter']
+DEFAULT_THREADS = [1, 2, 4, 8, 16, 32, 64]
+
+
+def run(root_dir, macro, threads, policy):
+    """运行一次，返回各run的 Events/s 的平均值"""
+    result = subprocess.run(['./build/CompScintSim', '-m', macro, '-batch', '-t', str(threads), '-pin', policy],
+                            cwd=root_dir, capture_output=True, text=True)
+    if result.returncode != 0:
+        raise RuntimeError(f'{threads} threads, {policy} failed:\n{result.stdout[-2000:]}\n{result.stderr[-2000:]}')
+    rates = [float(x) for x in re.findall(r'Events/s: ([0-9.eE+-]+)', result.stdout)]
+    return sum(rates) / len(rates) if rates else 0.
+
+
+def main():
+    root_dir = os.path.abspath(os.path.join(os.path.dirname(__file__), '..'))
+    macro = sys.argv[1] if len(sys.argv) > 1 else 'mac/single_particle.mac'
+    threads = [int(x) for x in sys.argv[2:]] or DEFAULT_THREADS
+
+    print('| threads | ' + ' | '.join(f'{p} events/s' for p in POLICIES) + ' | ' +
+          ' | '.join(f'{p} speedup' for p in POLICIES) + ' |')
+    print('|---' * (1 + 2 * len(POLICIES)) + '|')
+    base = {}
+    for n in threads:
+        rates = {}
+        for policy in POLICIES:
+            print(f'running {n} threads, pin {policy} ...', file=sys.stderr)
+            rates[policy] = run(root_dir, macro, n, policy)
+            base.setdefault(policy, rates[policy])
+        speedups = [rates[p] / base[p] if base[p] > 0 else 0. for p in POLICIES]
+        print(f'| {n} | ' + ' | '.join(f'{rates[p]:.1f}' for p in POLICIES) + ' | ' +
+              ' | '.join(f'{s:.2f}' for s in speedups) + ' |')
+
+
+if __name__ == '__main__':
+    main()
@@ -40,6 +40,17 @@
 
 class CompScintSimDetectorMessenger;
 class G4GlobalMagFieldMessenger;
+class G4LogicalVolume;
+
+// 体积在世界坐标系中的位置和姿态；复制放置的各层共用逻辑体，没有各自的物理体，由此给出各层的坐标
+struct VolumeFrame
+{
+  G4LogicalVolume* logical = nullptr;
+  G4ThreeVector position;
+  G4RotationMatrix rotation;
+
+  G4Transform3D GetTransform() const { return G4Transform3D(rotation, position); }
+};
 
 class CompScintSimDetectorConstruction : public G4VUserDetectorConstruction
 {
@@ -50,14 +61,27 @@ class CompScintSimDetectorConstruction : public G4VUserDetectorConstruction
   G4VPhysicalVolume* Construct() override;
   void ConstructSDandField() override;
 
+  // 两次运行之间由新的几何CSV文件重建几何和灵敏探测器，物理表保留
+  void ReloadGeometry(const G4String& fileName);
+
   void SetDumpGdml(G4bool);
   G4bool IsDumpGdml() const;
   void SetVerbose(G4bool verbose);
   G4bool IsVerbose() const;
+  void SetBooleanFreeLayers(G4bool);
+  G4bool IsBooleanFreeLayers() const;
+  void SetSurfaceCoatingThreshold(G4double);
+  G4double GetSurfaceCoatingThreshold() const;
+  void SetReplicateLayers(G4bool);
+  G4bool IsReplicateLayers() const;
+  void SetOverlapCheck(const G4String&);
+  G4String GetOverlapCheck() const;
   void SetDumpGdmlFile(G4String);
   G4String GetDumpGdmlFile() const;
 
   MyPhysicalVolume* GetMyVolume(G4String volumeName) const;
+  // 放置的体积和复制放置的各层的世界坐标，源和相空间平面使用
+  VolumeFrame GetVolumeFrame(const G4String& volumeName) const;
 
 MyPhysicalVolume* BuildScintillatorLayer(
     G4int copynumber,
@@ -74,16 +98,31 @@ MyPhysicalVolume* BuildScintillatorLayer(
     MyPhysicalVolume* mother_phys,
     G4ThreeVector position);
 
+  // 复制放置一组相同定义的连续层，不能复制放置时返回false
+  G4bool BuildReplicatedLayers(
+    const std::vector<G4int>& run,
+    MyPhysicalVolume* mother_phys,
+    G4double z_bottom);
+
+  // 为层的闪烁体建立区域scint_layer_<id>_region，产生阈值取自几何CSV
+  void SetLayerRegion(G4int copynumber, G4double production_cut);
+
  private:
   void PrintError(G4String);
 
   std::map<G4String, MyPhysicalVolume*> fVolumeMap; // 维护需要别处引用的Solid
+  std::map<G4String, VolumeFrame> fReplicaFrames;   // 复制放置的第2层起各层的坐标
 
   CompScintSimDetectorMessenger* fDetectorMessenger;
   G4String fDumpGdmlFileName;
 
   G4bool fVerbose;
   G4bool fDumpGdml;
+  G4bool fBooleanFreeLayers; // 用基本体和光纤端口子体积代替布尔体构建层
+  G4double fSurfaceCoatingThreshold; // 比该厚度薄的coating不建体积，只用光学表面表示
+  G4bool fReplicateLayers; // 相同定义的连续层用G4PVReplica放置
+  std::vector<std::vector<G4int>> fReplicatedLayerRuns; // 复制放置的各组层的copynumber
+  G4String fOverlapCheck; // 重叠检查模式：auto、validate、require或off
 
 };
 
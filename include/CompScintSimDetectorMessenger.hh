@@ -39,6 +39,8 @@ class G4VUserDetectorConstruction;
 class G4UIdirectory;
 class G4UIcmdWithABool;
 class G4UIcmdWithAString;
+class G4UIcmdWithADouble;
+class G4UIcmdWithADoubleAndUnit;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -51,9 +53,18 @@ public:
 private:
     G4VUserDetectorConstruction* fCompScintSimDetCon;
     G4UIdirectory* fDetConDir;
+    G4UIdirectory* fGeometryDir;
+    G4UIcmdWithAString* fReloadGeometryCmd;
+    G4UIcmdWithADoubleAndUnit* fLightGuideLengthCmd;
     G4UIcmdWithABool* fVerboseCmd;
     G4UIcmdWithABool* fDumpGdmlCmd;
+    G4UIcmdWithABool* fBooleanFreeLayersCmd;
+    G4UIcmdWithABool* fReplicateLayersCmd;
+    G4UIcmdWithADoubleAndUnit* fSurfaceCoatingThresholdCmd;
     G4UIcmdWithAString* fDumpGdmlFileNameCmd;
+    G4UIcmdWithAString* fOverlapCheckCmd;
+    G4UIcmdWithAString* fMaterialDatabaseCmd;
+    G4UIcmdWithADouble* fResampleOpticalTablesCmd;
 };
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 #endif
@@ -39,6 +39,7 @@
 #include <vector>
 
 class CompScintSimRunAction;
+struct LayerSnapshot;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -63,8 +64,14 @@ class CompScintSimEventAction : public G4UserEventAction
   // 存储各层能量沉积
   std::vector<G4double> fEnergyDeposit;
   
-  // 存储层copynumber
-  std::vector<G4int> fLayerCopynumbers;
+  // 层参数快照，几何重新载入后ScintillatorLayerManager返回新的快照
+  const LayerSnapshot* fLayers = nullptr;
+
+  // 事件开始的时刻（StartupBenchmark::Elapsed），用于线程负载统计
+  G4double fEventStart = 0.;
+
+  // 由ScintillatorLayerManager更新层列表（构造时和几何重新载入后）
+  void UpdateLayers();
 };
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 #endif
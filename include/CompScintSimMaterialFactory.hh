@@ -8,7 +8,7 @@
 /**
  * @brief 材料工厂类
  * 
- * 提供根据材料名称动态创建材料的功能
+ * 提供根据材料名称动态创建材料的功能，材料由MaterialManager提供
  */
 class CompScintSimMaterialFactory {
 public:
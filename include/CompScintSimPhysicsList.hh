@@ -0,0 +1,90 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+/// \file CompScintSim/include/CompScintSimPhysicsList.hh
+/// \brief Definition of the CompScintSimPhysicsList class
+//
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#ifndef CompScintSimPhysicsList_h
+#define CompScintSimPhysicsList_h 1
+
+#include "globals.hh"
+#include "G4VModularPhysicsList.hh"
+
+#include <vector>
+
+class CompScintSimPhysicsListMessenger;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/**
+ * @brief 可选预设的物理列表
+ *
+ * 预设由命令行 -physics 给出，逗号分隔，未给出的项使用默认值：
+ *   电磁物理：em0（G4EmStandardPhysics）、em3（option3）、em4（option4，默认）、livermore
+ *   强子物理：hadronic（默认，与FTFP_BERT相同的构造器）或 nohadronic（只保留衰变）
+ *   光学物理：optical 或 nooptical（默认取config.hh中的g_has_opticalPhysics）
+ *   光学过程：scintillation、cerenkov、absorption、rayleigh、wls，加前缀no关闭
+ *            （默认只关闭cerenkov）
+ * 例如 -physics em3,nohadronic 或 -physics optical,cerenkov,norayleigh
+ *
+ * 光学过程开关和步长限制写入G4OpticalParameters，在构建物理过程时生效；
+ * 也可用 /CompScintSim/optical/ 下的命令在PreInit状态修改。
+ */
+class CompScintSimPhysicsList : public G4VModularPhysicsList
+{
+ public:
+  CompScintSimPhysicsList(const G4String& preset = "");
+  ~CompScintSimPhysicsList() override;
+
+  // 设置产生阈值后准备物理表缓存（见PhysicsTableCache）
+  void SetCuts() override;
+
+  // 预设的规范写法，用于输出和记录
+  const G4String& GetPresetName() const { return fPresetName; }
+  G4bool HasOptical() const { return fOptical; }
+
+  // 光学过程开关，process为GetOpticalProcessNames()中的名字
+  void SetOpticalProcess(const G4String& process, G4bool active);
+  void SetMaxPhotonsPerStep(G4int photons);
+  void SetMaxBetaChange(G4double percent);
+  void SetTrackSecondariesFirst(G4bool first);
+  void SetScintByParticleType(G4bool byParticleType);
+  static const std::vector<G4String>& GetOpticalProcessNames();
+  static G4bool IsOpticalProcess(const G4String& process);
+
+  // 当前的光学物理设置，输出在run开始时
+  G4String GetOpticalSummary() const;
+
+ private:
+  G4String fPresetName;
+  G4bool fOptical;
+  CompScintSimPhysicsListMessenger* fMessenger;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
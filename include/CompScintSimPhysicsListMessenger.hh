@@ -0,0 +1,45 @@
+#ifndef PhysicsListMessenger_h
+#define PhysicsListMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+#include <map>
+
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithADouble;
+class G4UIcmdWithAnInteger;
+class G4UIdirectory;
+class CompScintSimPhysicsList;
+
+/**
+ * @brief 物理列表的运行时设置
+ *
+ * /CompScintSim/physics/：物理表缓存
+ * /CompScintSim/optical/：光学物理。过程开关在构建物理过程时生效，只能在PreInit状态使用；
+ * 关闭的过程不会挂到粒子上，不产生也不需要事后删除次级光子。
+ */
+class CompScintSimPhysicsListMessenger : public G4UImessenger
+{
+public:
+    CompScintSimPhysicsListMessenger(CompScintSimPhysicsList *physicsList);
+    virtual ~CompScintSimPhysicsListMessenger();
+
+    virtual void SetNewValue(G4UIcommand *cmd, G4String newValue);
+
+private:
+    CompScintSimPhysicsList *fPhysicsList;
+
+    G4UIdirectory *fPhysicsDir;
+    G4UIcmdWithAString *fTableCacheCmd;
+
+    G4UIdirectory *fOpticalDir;
+    std::map<G4UIcommand*, G4String> fProcessCmds; // 过程开关命令 -> 过程名（scintillation等）
+    G4UIcmdWithAnInteger *fMaxPhotonsPerStepCmd;
+    G4UIcmdWithADouble *fMaxBetaChangeCmd;
+    G4UIcmdWithABool *fTrackSecondariesFirstCmd;
+    G4UIcmdWithABool *fScintByParticleTypeCmd;
+};
+
+#endif
@@ -43,7 +43,10 @@
 #include "G4ThreeVector.hh"
 #include <vector>
 #include <string>
+#include <memory>
 #include <mutex>  // 添加互斥锁的头文件
+#include "PrimaryFile.hh"
+#include "OpticalPhotonSource.hh"
 
 class G4Event;
 class CompScintSimPrimaryGeneratorMessenger;
@@ -59,6 +62,16 @@ struct MyGPSSource {
         : id(sourceId), particleType(type), energy(e), count(c) {}
 };
 
+// 粒子源模式
+enum class SourceMode {
+    ParticleGun,  // 单一ParticleGun，垂直向下入射
+    GPS,          // 自定义GPS多粒子源
+    Omni,         // 各向同性源，仅抽样与探测器包围盒相交的径迹，并附带几何权重
+    Replay,       // 从初级粒子文件（/MySim/dumpPrimaries生成）重放
+    OpticalPhoton,// 在指定闪烁层内按发射谱分块产生光学光子
+    PhaseSpace    // 从层间相空间文件（/MySim/phaseSpace生成）的平面处重新开始
+};
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 class CompScintSimPrimaryGeneratorAction : public G4VUserPrimaryGeneratorAction
@@ -75,10 +88,30 @@ class CompScintSimPrimaryGeneratorAction : public G4VUserPrimaryGeneratorAction
   G4ParticleGun* GetParticleGun() { return fParticleGun; }
   G4GeneralParticleSource* GetGPS() { return fGPS; }
 
-  void UseParticleGun(G4bool useGun) { useParticleGun = useGun; }
+  void UseParticleGun(G4bool useGun) { SetUseParticleGun(useGun); }
   void SetUseParticleGun(G4bool useGun);
   G4bool GetUseParticleGun() { return useParticleGun; }
 
+  void SetSourceMode(SourceMode mode);
+  SourceMode GetSourceMode() const { return fSourceMode; }
+
+  // 各向同性源：探测器包围盒向外扩展的余量
+  void SetOmniMargin(G4double margin) { fOmniMargin = margin; fOmniInitialized = false; }
+
+  // 每次运行开始时调用，几何可能已重新载入，重新读取源所依赖的体积
+  void ResetGeometry() { isInitialized = false; fOmniInitialized = false; fOpticalSource.Reset(); }
+
+  // 重放源：设置初级粒子文件，文件在首次使用时映射
+  void SetReplayFile(const G4String& fileName) { fReplayFileName = fileName; fReplayReader.reset(); }
+  const G4String& GetReplayFile() const { return fReplayFileName; }
+
+  // 相空间源：设置相空间文件，文件在首次使用时映射
+  void SetPhaseSpaceFile(const G4String& fileName) { fPhaseSpaceFileName = fileName; fPhaseSpaceReader.reset(); }
+  const G4String& GetPhaseSpaceFile() const { return fPhaseSpaceFileName; }
+
+  // 光学光子源，StackingAction从中取后续的光子块
+  OpticalPhotonSource* GetOpticalSource() { return &fOpticalSource; }
+
   // 添加GPS源管理方法
   void AddGPSSource(const G4String& particleType, G4double energy, G4int count);
   void ClearGPSSources();
@@ -87,7 +120,8 @@ class CompScintSimPrimaryGeneratorAction : public G4VUserPrimaryGeneratorAction
  private:
   G4ParticleGun* fParticleGun;
   G4GeneralParticleSource* fGPS; // 使用 GPS
-  bool useParticleGun; // 标记使用哪种粒子源
+  bool useParticleGun; // 标记使用哪种粒子源（Omni模式同样使用ParticleGun）
+  SourceMode fSourceMode;
 
   // 添加互斥锁以防止多线程竞态条件
   static std::mutex fGPSMutex;
@@ -108,6 +142,32 @@ class CompScintSimPrimaryGeneratorAction : public G4VUserPrimaryGeneratorAction
   // 跟踪当前事件索引和总粒子数
   G4int fCurrentEventIndex;
   G4int fTotalParticleCount;
+
+  // 各向同性源：在包围盒表面按面积抽样入射点，按余弦律抽样入射方向
+  void InitializeOmniSource();
+  void GenerateOmniPrimary(G4Event* anEvent);
+
+  G4bool fOmniInitialized;
+  G4double fOmniMargin;
+  G4ThreeVector fOmniMin, fOmniMax;   // 包围盒（世界坐标）
+  G4double fOmniFaceCDF[6];           // 六个面按面积的累积分布
+  G4double fOmniWeight;               // 几何权重 = S/(4*pi*R^2)，R为包围盒外接球半径
+  G4double fOmniFluencePerPrimary;    // 每个初级粒子对应的各向同性注量 = 4/S
+
+  // 重放源：第k个事件取文件中第 k % nEvents 个事件
+  void GenerateReplayPrimary(G4Event* anEvent);
+
+  G4String fReplayFileName;
+  std::shared_ptr<const PrimaryFileReader> fReplayReader;
+  G4bool fReplayWrapWarned;
+
+  OpticalPhotonSource fOpticalSource;
+
+  // 相空间源：第k个事件取原始运行中第k个事件穿过平面的粒子，与原始事件一一对应
+  void GeneratePhaseSpacePrimary(G4Event* anEvent);
+
+  G4String fPhaseSpaceFileName;
+  std::shared_ptr<const PrimaryFileReader> fPhaseSpaceReader;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -43,6 +43,7 @@ class G4UIdirectory;
 class G4UIcmdWithADoubleAndUnit;
 class G4UIcmdWithABool;
 class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
 class G4UIcommand;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -60,6 +61,13 @@ class CompScintSimPrimaryGeneratorMessenger : public G4UImessenger
   G4UIdirectory* fGunDir;
   G4UIcmdWithADoubleAndUnit* fPolarCmd;
   G4UIcmdWithABool* fSetUseParticleGunCmd;
+  G4UIcmdWithAString* fSourceModeCmd;
+  G4UIcmdWithADoubleAndUnit* fOmniMarginCmd;
+  G4UIcmdWithAString* fReplayFileCmd;
+  G4UIcmdWithAString* fPhaseSpaceFileCmd;
+  G4UIcmdWithAnInteger* fOpticalLayerCmd;
+  G4UIcmdWithAnInteger* fOpticalPhotonsCmd;
+  G4UIcmdWithAnInteger* fOpticalChunkCmd;
   
   // GPS源相关命令
   G4UIcommand* fAddGPSSourceCmd;
@@ -38,6 +38,9 @@
 #include "G4Run.hh"
 #include "globals.hh"
 
+#include <map>
+#include <vector>
+
 class G4ParticleDefinition;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -52,12 +55,54 @@ class CompScintSimRun : public G4Run
 
   virtual void Merge(const G4Run*) override;
   virtual void RecordEvent(const G4Event*) override;
-  void EndOfRun();
+  void EndOfRun() const;
+
+  // 事件权重统计（各向同性等有偏源）
+  G4double GetSumWeight() const { return fSumWeight; }
+  G4double GetSumWeight2() const { return fSumWeight2; }
+  G4double GetSumFluence() const { return fSumFluence; }
+  // 计入权重统计的（未被中止的）事件数
+  G4int GetNumberOfAcceptedEvents() const { return fAcceptedEvents; }
+
+  // 步数统计，用于评估几何和光学输运的速度
+  void AddStep(G4bool opticalPhoton) { fSteps++; if (opticalPhoton) fOpticalPhotonSteps++; }
+  void AddSteps(G4long steps, G4long opticalPhotonSteps) { fSteps += steps; fOpticalPhotonSteps += opticalPhotonSteps; }
+  G4long GetSteps() const { return fSteps; }
+  G4long GetOpticalPhotonSteps() const { return fOpticalPhotonSteps; }
+
+  // 线程负载统计，时间为程序启动以来的墙钟时间（StartupBenchmark::Elapsed）
+  struct ThreadLoad {
+    G4int threadId = -1;
+    G4int events = 0;
+    G4double busy = 0.;          // 处理事件的时间之和
+    G4double lastEventEnd = -1.; // 最后一个事件结束的时刻
+  };
+  void AddEventTime(G4double start, G4double end);
+  void SetStartTime(G4double start) { fStartTime = start; }
+  // 输出各线程的忙碌时间和尾部空闲时间，只在主线程调用
+  void PrintThreadLoads() const;
+
+  // 被中止的事件数（按原因），中止的事件不计入权重统计
+  void AddAbortedEvent(const G4String& reason) { fAbortedEvents[reason]++; }
+  void PrintAbortedEvents() const;
 
  public:
   G4ParticleDefinition* fParticle;
   G4double fEnergy;
 
+ private:
+  G4double fSumWeight;   // 事件权重之和
+  G4double fSumWeight2;  // 事件权重平方和，用于计算有效事件数
+  G4double fSumFluence;  // 初级粒子对应的各向同性注量之和
+  G4int fAcceptedEvents; // 未被中止的事件数，权重统计的分母
+  G4long fSteps;              // 所有粒子的步数
+  G4long fOpticalPhotonSteps;  // 光学光子的步数
+
+  G4double fStartTime;                   // 主线程开始run的时刻
+  ThreadLoad fLoad;                      // 本线程的负载
+  std::vector<ThreadLoad> fThreadLoads;  // 合并得到的各工作线程负载
+  std::map<G4String, G4int> fAbortedEvents; // 中止原因 -> 事件数
+
 };
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 #endif
@@ -36,7 +36,10 @@
 
 #include "globals.hh"
 #include "G4UserRunAction.hh"
+#include "G4Timer.hh"
 #include <fstream>
+#include "PrimaryFile.hh"
+#include "PhaseSpaceRecorder.hh"
 
 class G4Run;
 class CompScintSimRun;
@@ -61,6 +64,30 @@ class CompScintSimRunAction : public G4UserRunAction
   // 获取线程特定的CSV文件名
   G4String GetThreadCsvFileName() const { return fThreadCsvFileName; }
 
+  // 线程CSV文件每行开头的事件索引列数（eventID、三个种子、初级粒子个数、种类、动能、
+  // 状态和耗时），合并时写入<输出文件>_index.csv
+  static const G4int kEventIndexColumns = 9;
+
+  // 初级粒子转储文件，为空时不转储
+  void SetPrimaryDumpFileName(G4String name) { fPrimaryDumpFileName = name; }
+  G4String GetPrimaryDumpFileName() const { return fPrimaryDumpFileName; }
+
+  // 线程局部的初级粒子写入器，未开启转储时返回nullptr
+  PrimaryFileWriter* GetPrimaryWriter() { return fPrimaryWriter.IsOpen() ? &fPrimaryWriter : nullptr; }
+
+  // 层间相空间记录器
+  PhaseSpaceRecorder* GetPhaseSpaceRecorder() { return &fPhaseSpaceRecorder; }
+
+  // 步数统计
+  void CountStep(G4bool opticalPhoton);
+  void CountSteps(G4long steps, G4long opticalPhotonSteps);
+
+  // 事件处理时间统计，用于线程负载报告
+  void CountEventTime(G4double start, G4double end);
+
+  // 被EventWatchdog或其他原因中止的事件
+  void CountAbortedEvent(const G4String& reason);
+
  private:
   CompScintSimRun* fRun;
   CompScintSimPrimaryGeneratorAction* fPrimary;
@@ -69,6 +96,11 @@ class CompScintSimRunAction : public G4UserRunAction
   G4String fThreadCsvFileName;  // 线程特定的CSV文件名
   CompScintSimRunActionMessenger* fMessenger; // 运行动作的消息处理器 
 
+  G4String fPrimaryDumpFileName;    // 初级粒子转储文件名
+  PrimaryFileWriter fPrimaryWriter; // 线程局部的初级粒子写入器
+  PhaseSpaceRecorder fPhaseSpaceRecorder; // 线程局部的相空间记录器
+  G4Timer fTimer;                         // 运行计时，用于计算光学光子步速
+
   bool fileExists(const G4String& fileName);
   G4String getNewfileName(G4String baseFileName, G4String fileExtension);
 };
@@ -5,6 +5,11 @@
 #include "globals.hh"
 
 class G4UIcmdWithAString;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithABool;
+class G4UIcmdWithoutParameter;
+class G4UIdirectory;
 class CompScintSimRunAction;
 
 class CompScintSimRunActionMessenger : public G4UImessenger
@@ -19,6 +24,31 @@ public:
 private:
     CompScintSimRunAction *fRunAction;               // 指向你的RunAction实例
     G4UIcmdWithAString *fSetFileNameCmd; // 设置文件名的命令
+    G4UIcmdWithAString *fDumpPrimariesCmd; // 设置初级粒子转储文件的命令
+
+    // 相空间命令
+    G4UIdirectory *fPhaseSpaceDir;
+    G4UIcmdWithAString *fPhaseSpaceFileCmd;
+    G4UIcmdWithADoubleAndUnit *fAddPlaneCmd;
+    G4UIcmdWithAnInteger *fAddPlaneBelowLayerCmd;
+    G4UIcmdWithoutParameter *fClearPlanesCmd;
+    G4UIcmdWithABool *fKillAtPlaneCmd;
+
+    // 工作线程绑定策略
+    G4UIcmdWithAString *fPinThreadsCmd;
+
+    // run种子，各事件的种子由其派生
+    G4UIcmdWithAString *fRunSeedCmd;
+
+    // 单事件重放
+    G4UIcommand *fReplayCmd;
+
+    // 单个事件的时间和步数预算
+    G4UIcmdWithADoubleAndUnit *fEventTimeLimitCmd;
+    G4UIcmdWithAnInteger *fEventStepLimitCmd;
+
+    // 光学光子分批处理
+    G4UIcmdWithAnInteger *fPhotonBatchSizeCmd;
 };
 
 #endif
@@ -35,13 +35,16 @@
 
 #include "globals.hh"
 #include "G4UserStackingAction.hh"
+#include <vector>
+
+class CompScintSimPrimaryGeneratorAction;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 class CompScintSimStackingAction : public G4UserStackingAction
 {
  public:
-  CompScintSimStackingAction();
+  CompScintSimStackingAction(CompScintSimPrimaryGeneratorAction* primary = nullptr);
   ~CompScintSimStackingAction();
 
   G4ClassificationOfNewTrack ClassifyNewTrack(const G4Track* aTrack) override;
@@ -52,6 +55,7 @@ class CompScintSimStackingAction : public G4UserStackingAction
   std::vector<G4double> GetScintillationWavelengths() const;
 
  private:
+  CompScintSimPrimaryGeneratorAction* fPrimary;
   G4int fScintillationPhotonCount;
   std::vector<G4double> fScintillationWavelengths; // 用于存储闪烁光波长
 
@@ -34,16 +34,19 @@
 #include "globals.hh"
 #include "G4UserSteppingAction.hh"
 
+class CompScintSimRunAction;
+
 class CompScintSimSteppingAction : public G4UserSteppingAction
 {
  public:
-  CompScintSimSteppingAction(CompScintSimEventAction*);
+  CompScintSimSteppingAction(CompScintSimEventAction*, CompScintSimRunAction* = nullptr);
   ~CompScintSimSteppingAction();
 
   void UserSteppingAction(const G4Step*) override;
   
  private:
   CompScintSimEventAction* fEventAction;
+  CompScintSimRunAction* fRunAction;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,49 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+/// \file CompScintSimWorkerInitialization.hh
+/// \brief Definition of the CompScintSimWorkerInitialization class
+
+#ifndef CompScintSimWorkerInitialization_h
+#define CompScintSimWorkerInitialization_h 1
+
+#include "G4UserWorkerInitialization.hh"
+
+/**
+ * @brief 工作线程初始化
+ *
+ * WorkerInitialize在工作线程创建用户动作、几何和物理的线程状态之前调用，
+ * 在这里按ThreadPinning的策略绑定线程，使之后分配的线程状态位于本地内存。
+ */
+class CompScintSimWorkerInitialization : public G4UserWorkerInitialization
+{
+ public:
+  CompScintSimWorkerInitialization() = default;
+  ~CompScintSimWorkerInitialization() override = default;
+
+  void WorkerInitialize() const override;
+};
+
+#endif
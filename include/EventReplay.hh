@@ -0,0 +1,44 @@
+#ifndef EventReplay_hh
+#define EventReplay_hh 1
+
+#include "globals.hh"
+
+#include <fstream>
+#include <mutex>
+
+class G4Track;
+
+/**
+ * @brief 按记录的种子单独重新模拟一个事件
+ *
+ * 每个事件的种子只由 (run种子, runID, eventID) 决定（EventSeeder），run结束时与初级粒子摘要、
+ * 处理时间一起写入 <输出文件>_index.csv。沉积异常或耗时远超中位数的事件可用
+ * /CompScintSim/replay <run> <eventID> [trackingVerbose] [photonFile] 单独重放：
+ * 执行一个只含该事件的run（由一个线程处理），初级粒子发生器使用原事件的种子和eventID，
+ * 结果与原run中该事件相同。run种子须与原run相同（-r 或 /MySim/runSeed），
+ * 源的设置须与原run相同（执行同一宏文件）。
+ *
+ * 重放时可打开逐步输出（/tracking/verbose），并把每个光学光子径迹的产生点、终点、
+ * 步数和终止过程写入光子文件。这些诊断只在重放时打开，生产运行不受影响。
+ */
+class EventReplay {
+public:
+    // 重放一个事件，只在主线程的Idle状态调用；photonFile为空时不输出光子
+    static void Replay(G4int runID, G4int eventID, G4int trackingVerbose, const G4String& photonFile);
+
+    static G4bool IsActive() { return fActive; }
+    static G4int GetRunID() { return fRunID; }
+    static G4int GetEventID() { return fEventID; }
+
+    // 在径迹结束时调用，重放且打开光子输出时记录光学光子径迹
+    static void DumpPhoton(const G4Track* track);
+
+private:
+    static G4bool fActive;
+    static G4int fRunID;
+    static G4int fEventID;
+    static std::mutex fMutex;
+    static std::ofstream fPhotonFile;
+};
+
+#endif
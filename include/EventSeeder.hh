@@ -0,0 +1,47 @@
+#ifndef EventSeeder_hh
+#define EventSeeder_hh 1
+
+#include "globals.hh"
+
+#include <cstdint>
+
+/**
+ * @brief 由一个64位run种子确定每个事件的随机数种子
+ *
+ * Geant4的多线程运行管理器由主线程的随机数引擎依次生成各事件的种子，
+ * 种子与事件的对应关系取决于运行管理器类型和 /run/eventModulo 的设置；
+ * 初级粒子发生器中的std::mt19937则以时间为种子。为使事件结果与线程数和调度无关，
+ * 每个事件开始时（GeneratePrimaries的第一步）按 (run种子, runID, eventID) 重新设置
+ * Geant4引擎和辅助随机数发生器的种子，同一事件在任何线程、任何运行方式下结果相同。
+ *
+ * run种子由 -r 或 /MySim/runSeed 给出（十进制或0x开头的十六进制），未给出时取当前时间，
+ * 并在运行开始时输出，以便复现。各事件使用的种子记录在 <输出文件>_seeds.csv 中。
+ */
+class EventSeeder {
+public:
+    // 一个事件的种子：Geant4引擎的两个种子（31位正整数）和辅助发生器的64位种子
+    struct Seeds {
+        long engine[2] = {0, 0};
+        std::uint64_t aux = 0;
+    };
+
+    static void SetRunSeed(std::uint64_t seed) { fRunSeed = seed; }
+    static std::uint64_t GetRunSeed() { return fRunSeed; }
+
+    // 解析种子字符串，格式错误时返回false
+    static G4bool ParseSeed(const G4String& text, std::uint64_t& seed);
+
+    // 事件种子只由run种子、runID和eventID决定
+    static Seeds Derive(G4int runID, G4int eventID);
+
+    // 按事件种子重新设置当前线程的Geant4引擎，返回所用的种子
+    static Seeds SeedEvent(G4int runID, G4int eventID);
+
+    // 按事件的辅助种子和批号重新设置Geant4引擎，用于分批处理的光学光子（OpticalPhotonScheduler）
+    static void SeedBatch(std::uint64_t eventSeed, G4int batch);
+
+private:
+    static std::uint64_t fRunSeed;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef EventWatchdog_hh
+#define EventWatchdog_hh 1
+
+#include "globals.hh"
+
+/**
+ * @brief 单个事件的墙钟时间和步数预算
+ *
+ * 少数事件（被全反射困住的光子、很长的簇射）可能运行数分钟，拖长run的尾部。
+ * 每个工作线程在处理事件时按步计数，超出步数预算或墙钟时间预算时通过
+ * G4EventManager::AbortCurrentEvent中止该事件，中止原因记录在MyEventInfo中。
+ * 中止的事件不写入合并后的CSV，在事件索引（<输出文件>_index.csv）中标记原因，
+ * 可用 /CompScintSim/replay 单独重放；run结束时按原因输出中止的事件数。
+ *
+ * 预算由 /MySim/eventTimeLimit 和 /MySim/eventStepLimit 设置，0表示不限制（默认）。
+ * 墙钟时间每 kTimeCheckInterval 步检查一次。
+ */
+class EventWatchdog {
+public:
+    static void SetTimeLimit(G4double seconds) { fTimeLimit = seconds; }
+    static void SetStepLimit(G4long steps) { fStepLimit = steps; }
+    static G4double GetTimeLimit() { return fTimeLimit; }
+    static G4long GetStepLimit() { return fStepLimit; }
+    static G4bool IsEnabled() { return fTimeLimit > 0. || fStepLimit > 0; }
+
+    // 在事件开始时调用，重置当前线程的计时和步数
+    static void BeginEvent();
+
+    // 每步调用，超出预算时中止当前事件
+    static void CheckStep();
+
+    // 当前线程的事件已被中止；中止后不再压入新的径迹（光学光子源的下一块）
+    static G4bool IsAborted() { return fAborted; }
+
+    // 中止原因的名称，写入事件索引的status列
+    static const char* kAbortTime;
+    static const char* kAbortSteps;
+    static const char* kAbortOther;
+
+private:
+    static void Abort(const char* reason);
+
+    static const G4int kTimeCheckInterval = 1000;
+
+    static G4double fTimeLimit;
+    static G4long fStepLimit;
+    static G4ThreadLocal G4double fEventStart;
+    static G4ThreadLocal G4long fSteps;
+    static G4ThreadLocal G4bool fAborted;
+};
+
+#endif
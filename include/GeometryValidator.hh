@@ -0,0 +1,53 @@
+#ifndef GeometryValidator_hh
+#define GeometryValidator_hh 1
+
+#include "globals.hh"
+
+#include <cstdint>
+
+class G4VPhysicalVolume;
+
+/**
+ * @brief 几何重叠检查及其缓存
+ *
+ * 放置物理体时不再逐个检查重叠，而是在几何构建完成后统一检查：
+ * 从世界体向下遍历所有放置的物理体，在多个线程中并行调用CheckOverlaps。
+ * 检查结果与几何的哈希（几何CSV文件内容和影响几何的配置）一起写入缓存文件
+ * <几何CSV文件>.overlaps，几何未变化时后续运行直接使用缓存结果。
+ *
+ * 检查模式（/CompScintSim/DetectorConstruction/overlapCheck）：
+ *   auto     哈希与缓存一致时跳过检查，否则检查并更新缓存（默认）
+ *   validate 总是检查并更新缓存
+ *   require  哈希与缓存一致且检查通过时跳过，否则立即终止（用于生产运行）
+ *   off      不检查
+ * 检查发现重叠或缓存记录的结果为失败时终止程序。
+ */
+class GeometryValidator {
+public:
+    /**
+     * @brief 按模式检查几何重叠，只在主线程构建几何后调用
+     *
+     * @param world 世界体
+     * @param geometryFile 几何CSV文件，其内容参与哈希，缓存文件与之同目录
+     * @param config 影响几何的配置，参与哈希
+     * @param mode 检查模式
+     */
+    static void Check(G4VPhysicalVolume* world, const G4String& geometryFile,
+                      const G4String& config, const G4String& mode);
+
+    // 检查模式的候选值，供messenger使用
+    static G4String GetModeCandidates() { return "auto validate require off"; }
+
+private:
+    // 并行检查所有放置的物理体，返回发现重叠的物理体数
+    static G4int RunOverlapCheck(G4VPhysicalVolume* world, G4int& nVolumes);
+
+    // 几何CSV文件内容和配置的FNV-1a哈希
+    static std::uint64_t Hash(const G4String& geometryFile, const G4String& config);
+
+    // 读取缓存，缓存不存在或格式错误时返回false
+    static G4bool ReadCache(const G4String& cacheFile, std::uint64_t& hash, G4bool& passed);
+    static void WriteCache(const G4String& cacheFile, std::uint64_t hash, G4bool passed, G4int nVolumes);
+};
+
+#endif
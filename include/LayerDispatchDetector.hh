@@ -0,0 +1,29 @@
+#ifndef LayerDispatchDetector_hh
+#define LayerDispatchDetector_hh 1
+
+#include <unordered_map>
+
+#include "G4VSensitiveDetector.hh"
+
+/**
+ * @brief 复制放置的层共用的灵敏探测器
+ *
+ * 相同定义的连续层用G4PVReplica放置时共用一个逻辑体，只能挂一个灵敏探测器。
+ * 本探测器由ScintillatorLayerManager::GetLayerCopynumber按复制编号找到所在层，
+ * 把步转交给该层自己的探测器（G4MultiFunctionalDetector），各层的打分与单独放置时相同。
+ * 各层的探测器仍须注册到G4SDManager，以便每个事件初始化其hits collection。
+ */
+class LayerDispatchDetector : public G4VSensitiveDetector {
+public:
+    LayerDispatchDetector(const G4String& name);
+    ~LayerDispatchDetector() override = default;
+
+    void AddLayer(G4int copynumber, G4VSensitiveDetector* detector);
+
+    G4bool ProcessHits(G4Step* aStep, G4TouchableHistory*) override;
+
+private:
+    std::unordered_map<G4int, G4VSensitiveDetector*> fDetectors;
+};
+
+#endif
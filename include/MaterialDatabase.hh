@@ -0,0 +1,133 @@
+#ifndef MaterialDatabase_hh
+#define MaterialDatabase_hh 1
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "globals.hh"
+
+class G4Material;
+
+/**
+ * @brief 材料数据库文件格式（二进制，小端）
+ *
+ * [MaterialDBHeader]
+ * [MaterialDBIndex index[nEntries]]     按名称排序，用于二分查找
+ * 每个条目：[MaterialDBRecord]
+ *           [MaterialDBComponent components[nComponents]]
+ *           [MaterialDBConst consts[nConsts]]
+ *           nProperties个 { [MaterialDBProperty] [double energy[n]] [double value[n]] }
+ *
+ * 所有数值均为Geant4内部单位。文本源格式见 materials.txt 的文件头。
+ */
+struct MaterialDBHeader {
+    char magic[8];            // "CSSMATDB"
+    uint32_t version;         // 格式版本
+    uint32_t nEntries;        // 条目数（含别名）
+    uint64_t fileSize;        // 文件总大小，用于校验
+    uint64_t reserved;
+};
+
+struct MaterialDBIndex {
+    char name[48];            // 查找用的名称
+    uint64_t offset;          // MaterialDBRecord在文件中的偏移
+};
+
+struct MaterialDBRecord {
+    char g4name[48];          // G4Material的名称
+    char target[48];          // NIST材料名或别名指向的条目
+    int32_t kind;             // 见MaterialDatabase::EntryKind
+    int32_t state;            // G4State
+    uint32_t flags;           // 见MaterialDatabase::RecordFlag
+    uint32_t nComponents;
+    uint32_t nConsts;
+    uint32_t nProperties;
+    double density;
+    double birks;             // 默认伯克斯常数
+};
+
+struct MaterialDBComponent {
+    char name[48];            // 元素符号、子材料名或自定义元素名
+    char symbol[8];           // 自定义元素的符号
+    int32_t kind;             // 见MaterialDatabase::ComponentKind
+    int32_t byAtoms;          // 1: amount为原子数，0: amount为质量分数
+    double amount;
+    double Z, A;              // 仅自定义元素使用
+};
+
+struct MaterialDBConst {
+    char key[48];
+    double value;
+};
+
+struct MaterialDBProperty {
+    char key[48];
+    uint32_t nEntries;
+    uint32_t flags;           // 见MaterialDatabase::PropertyFlag
+};
+
+/**
+ * @brief 材料数据库
+ *
+ * 材料的组成、光学和闪烁性质保存在文本文件中（便于编辑和新增材料，无需重新编译），
+ * 首次使用时编译为同名的 .matdb 二进制文件并映射到内存，文本比二进制新时自动重新编译。
+ * 构建材料时只读取被请求的条目，几何中没有用到的材料不会被构建。
+ * 由MaterialManager调用，MaterialManager负责缓存已构建的材料。
+ */
+class MaterialDatabase {
+public:
+    enum EntryKind { kCompound = 0, kNist = 1, kAlias = 2 };
+    enum ComponentKind { kElement = 0, kCustomElement = 1, kSubMaterial = 2 };
+    enum RecordFlag { kScintillator = 1, kHasBirks = 2 };
+    enum PropertyFlag { kScaleWithAttenuation = 1, kScaleWithYield = 2 };
+
+    static MaterialDatabase& Instance();
+
+    // 数据库文件（文本或.matdb），须在第一次取材料之前设置
+    void SetFileName(const G4String& fileName);
+    const G4String& GetFileName() const { return fFileName; }
+
+    G4bool HasMaterial(const G4String& name);
+    G4bool IsScintillator(const G4String& name);
+    std::vector<G4String> GetMaterialNames(G4bool scintillators);
+
+    // 别名解析为实际条目名，不存在时原样返回
+    G4String ResolveName(const G4String& name);
+
+    /**
+     * @brief 由数据库条目构建材料
+     *
+     * 对闪烁体：lightYield != -1 时替换SCINTILLATIONYIELD（并按比例缩放标记为yield的性质），
+     * 标记为attenuation的性质（ABSLENGTH）乘以attenuationScale，birks < 0 时使用默认值。
+     * 子材料通过MaterialManager::GetMaterial获取以便共享。
+     *
+     * @return G4Material* 新建的材料，条目不存在时返回nullptr
+     */
+    G4Material* BuildMaterial(const G4String& name, G4double lightYield = -1,
+                              G4double attenuationScale = 1, G4double birks = -1);
+
+    // 将文本源编译为二进制文件
+    static void Compile(const G4String& textFile, const G4String& binaryFile);
+
+private:
+    MaterialDatabase();
+    ~MaterialDatabase();
+    MaterialDatabase(const MaterialDatabase&) = delete;
+    MaterialDatabase& operator=(const MaterialDatabase&) = delete;
+
+    void Open();
+    void Map(const G4String& binaryFile);
+    const MaterialDBRecord* FindRecord(const G4String& name);
+
+    G4String fFileName;
+    std::mutex fOpenMutex;
+    G4bool fOpened;
+
+    void* fData;
+    size_t fSize;
+    const MaterialDBHeader* fHeader;
+    const MaterialDBIndex* fIndex;
+};
+
+#endif
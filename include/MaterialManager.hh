@@ -6,12 +6,18 @@
 #include "MyMaterials.hh"
 #include <map>
 #include <functional>
+#include <mutex>
+#include <tuple>
 #include <vector>
 
 /**
  * @brief 材料管理器类，提供通过字符串获取材料的功能
  * 
- * 这个类是MyMaterials的扩展，允许通过字符串动态获取材料
+ * 这个类是MyMaterials和材料数据库（MaterialDatabase）的统一入口，允许通过字符串动态获取材料。
+ * 材料在第一次被请求时才构建，几何中没有用到的材料不会被读取。
+ * 材料按完整参数缓存，相同请求返回同一个G4Material，
+ * 不同参数的闪烁体变体使用不同的名称，避免重复构建材料和物理表。
+ * 新建材料的光学性质表按OpticalTableResampler的容差重采样到均匀网格（容差为0时不处理）。
  */
 class MaterialManager {
 private:
@@ -23,7 +29,13 @@ private:
     static std::map<G4String, std::function<G4Material*(G4double, G4double, G4double)>> scintillatorMap;
     
     // 标记是否已初始化
-    static bool mapsInitialized;
+    static std::once_flag mapsInitialized;
+
+    // 已创建材料的缓存，由cacheMutex保护
+    using ScintillatorKey = std::tuple<G4String, G4double, G4double, G4double>;
+    static std::map<G4String, G4Material*> materialCache;
+    static std::map<ScintillatorKey, G4Material*> scintillatorCache;
+    static std::recursive_mutex cacheMutex;
 
 public:
     /**
@@ -37,6 +49,9 @@ public:
     /**
      * @brief 通过材料名称获取闪烁体材料
      * 
+     * 相同 (名称, 光产额, 吸收长度, 伯克斯常数) 的请求返回同一材料，
+     * 材料名为 <名称>_LY<光产额>_ATT<吸收长度>_BK<伯克斯常数>
+     * 
      * @param materialName 材料名称
      * @param lightYield 光产额
      * @param attenuationLength 吸收长度
@@ -80,6 +95,16 @@ public:
      * @return std::vector<G4String> 闪烁体材料名称列表
      */
     static std::vector<G4String> GetSupportedScintillators();
+
+    /**
+     * @brief 获取已缓存的材料数量（普通材料+闪烁体变体）
+     */
+    static size_t GetNumberOfCachedMaterials();
+
+    /**
+     * @brief 获取构建材料（含光学性质表重采样）的累计耗时（s）
+     */
+    static G4double GetBuildTime();
 };
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef MYEVENTINFO_HH
+#define MYEVENTINFO_HH
+
+#include "G4VUserEventInformation.hh"
+#include "globals.hh"
+#include "EventSeeder.hh"
+
+// 事件级别的附加信息，由PrimaryGeneratorAction填写，EventAction/Run读取
+class MyEventInfo : public G4VUserEventInformation
+{
+public:
+    MyEventInfo();
+    virtual ~MyEventInfo();
+
+    void Print() const override;
+
+    // 事件权重（无偏源为1）
+    void SetWeight(G4double weight) { fWeight = weight; }
+    G4double GetWeight() const { return fWeight; }
+
+    // 该初级粒子所代表的各向同性注量 (1/面积)，非各向同性源为0
+    void SetFluencePerPrimary(G4double fluence) { fFluencePerPrimary = fluence; }
+    G4double GetFluencePerPrimary() const { return fFluencePerPrimary; }
+
+    // 该事件使用的随机数种子（EventSeeder），随事件结果一起记录
+    void SetSeeds(const EventSeeder::Seeds& seeds) { fSeeds = seeds; }
+    const EventSeeder::Seeds& GetSeeds() const { return fSeeds; }
+
+    // 事件被EventWatchdog中止的原因，未中止时为空
+    void SetAbortReason(const G4String& reason) { fAbortReason = reason; }
+    const G4String& GetAbortReason() const { return fAbortReason; }
+
+private:
+    G4double fWeight;
+    G4double fFluencePerPrimary;
+    EventSeeder::Seeds fSeeds;
+    G4String fAbortReason;
+};
+
+#endif
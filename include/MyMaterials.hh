@@ -20,73 +20,20 @@ public:
   MyMaterials();
   ~MyMaterials();
 
-  // new 
-  static G4Material* Boron();
-  static G4Material* TantalumFoil();
-  static G4Material* Graphite();
-  static G4Material* PEEK();
+  // 元素统一从G4NistManager取得（天然同位素丰度），同一元素全局只创建一次
+  static G4Element* GetElement(const G4String& symbol);
 
-  // old 
+  // 常用材料和全部闪烁体的组成及光学性质在材料数据库（materials.txt）中，通过MaterialManager获取；
+  // 这里只保留静态初始化时需要的材料和带参数的材料
   static G4Material* Vacuum();
-  static G4Material* Air();
-  static G4Material* AirKiller(); // special material with same prop of air but absorbing light
-  static G4Material* Water();
-  static G4Material* Silicon();
-  static G4Material* Aluminium();
-  static G4Material* Iron();
-  static G4Material* Lead();
-  static G4Material* Brass();
-  static G4Material* Tungsten();
-  static G4Material* TungstenLight();
   static G4Material* CopperTungstenAlloy(const G4double& WFrac);
-  static G4Material* Quartz();
-  static G4Material* OpticalGrease();
 
-
-  static G4Material* BaF2(double user_lightyield,double scaleFactor,double user_birks); // !! 光学性质照抄LYSO
-  static G4Material* NaI_Tl(double user_lightyield,double scaleFactor,double user_birks); // !! 光学性质照抄LYSO
-  static G4Material* CsI_Tl(double user_lightyield,double scaleFactor,double user_birks); // !! 光学性质照抄LYSO
-  static G4Material* CsI(double user_lightyield,double scaleFactor,double user_birks); // !! 光学性质照抄LYSO
-  static G4Material* GOS(double user_lightyield,double scaleFactor,double user_birks); // !! 光学性质照抄BGO
-  static G4Material* LSO(double user_lightyield,double scaleFactor,double user_birks); // !! 光学性质照抄LYSO
-  static G4Material* YSO(double user_lighyield,double scaleFactor,double user_birks);
-  static G4Material* LYSO(double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* LuAG_Ce(double user_lightyield,double scaleFactor,double user_birks); //
-  static G4Material* LuAG_Pr(double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* DSB_Ce(double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* SiO2_Ce(double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* BGO            (double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* PWO            (double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* CWO            (double user_lightyield,double scaleFactor,double user_birks); // !! 光学性质照抄PWO
-  static G4Material* YAG_Ce         (double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* GAGG_Ce_Mg     (double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* GAGG_ILM       (double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* GFAG           (double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* GYAGG          (double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* GAGG_very_fast (double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* GAGG_slow      (double user_lightyield,double scaleFactor,double user_birks);
-  static G4Material* Polystyrene    (double user_lightyield,double scaleFactor,double user_birks);
   static G4Material* PLEX           (double scaleFactor);
   static G4Material* FlurPoly       (double scaleFactor);
-  static G4Material* PVC();
-  static G4Material* CuAir(); //crystal tube
-  static G4Material* Cu(); // Wires
-  static G4Material* LAPPD_Average(); // average LAPPD material to fill space between front and back sections
-  static G4Material* StainlessSteel(); 
-  static G4Material* Copper(); 
-  static G4Material* ESR_Vikuiti(); 
-  static G4Material* LAPPD_Window(); // LAPPD quartz window
-  static G4Material* LAPPD_MCP(); // material of MCP inside LAPPD
-  static G4Material* Epoxy(); // Epoxy resin usually used in PCB materials. For the PCB of the LAPPD backplane
-  static G4Material* LAPPD_PCB(); // material of PCB on the backplance of LAPPD
-  static G4Material* GarthTypographicAlloy(); // Pb 84% - Sb 12% - 4% Sn - density 10 g/cm3
-  static G4Material* Tyvek();
   static G4Material* Pethylene(double scaleFactor);
-  static G4Material* PMMA();
   static G4Material* PMMA_Y11(double scaleFactor);
   static G4Material* PMMA_YS2(double scaleFactor);
   static G4Material* PMMA_YS4(double scaleFactor);
-  static G4Material* Shashlik_Polystyrene();
 
 
   static G4MaterialPropertiesTable* ESR(double esrTransmittance);      // ESR reflector surface
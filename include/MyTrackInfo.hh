@@ -28,6 +28,9 @@ public:
     // 用于在三次粒子创建时继承二次粒子的已穿过信息
     void InheritPassedLayers_secondary(const MyTrackInfo* parentInfo);
 
+    // 两者的层标记完全相同（光学光子分批暂存时合并相同的标记）
+    bool HasSamePassedLayers(const MyTrackInfo* other) const;
+
 private:
     // 针对不同 layer 的标记表
     // key: layerName, value: 是否已经穿过
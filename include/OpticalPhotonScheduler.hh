@@ -0,0 +1,144 @@
+#ifndef OpticalPhotonScheduler_hh
+#define OpticalPhotonScheduler_hh 1
+
+#include "globals.hh"
+#include "G4ThreeVector.hh"
+#include "PrimaryFile.hh"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class G4Track;
+class G4VProcess;
+class MyTrackInfo;
+
+/**
+ * @brief 把一个事件的光学光子分批交给空闲的工作线程
+ *
+ * 高能质子等事件产生10^5–10^6个光学光子，全部由处理该事件的线程输运，其他线程在run的末尾空闲。
+ * 打开分批（/MySim/photonBatchSize N，0表示关闭，默认）后：
+ *   1. 带电粒子阶段产生的光学光子在StackingAction::ClassifyNewTrack中记录下来并从堆栈中删除；
+ *   2. 带电粒子阶段结束（第一次NewStage）时，光子按产生顺序每N个分为一批，放入所有线程共享的队列；
+ *   3. 本线程在NewStage中依次取出本事件尚未被取走的批压入堆栈处理；已经处理完所有事件的线程
+ *      在EndOfRunAction中从队列取批，作为只含这些光子的事件处理；
+ *   4. 本事件的批都处理完后，本线程在EndOfEventAction中按批的顺序把各批的能量沉积、步数和
+ *      相空间记录加到本事件。
+ * 每批开始时按 (事件种子, 批号) 重新设置随机数引擎（EventSeeder::SeedBatch），批的结果只取决于
+ * 其中的光子，与处理它的线程无关，按批的顺序相加后事件的输出与顺序运行相同。
+ * 批中由光子产生的次级光子（波长位移）在同一批内处理。光子的MyTrackInfo（已穿过的层）随光子暂存，
+ * 压入批时复制给重建的径迹；径迹的trackID与不分批时不同。
+ *
+ * 处理他人批的线程不受本线程事件预算的限制，每批有自己的时间和步数预算；
+ * 批被中止时整个源事件按中止处理。分批时每个光子暂存约100字节。
+ *
+ * 限制：
+ *   - 其他线程只在自己的EndOfRunAction中取批。Tasking运行管理器（Geant4 11多线程构建中
+ *     -runManager Default 的默认选择）的工作线程在所有事件任务结束后才执行EndOfRunAction，
+ *     无法在事件循环中帮助，因此Tasking下拒绝打开分批（SetBatchSize给出警告），须用 -runManager MT；
+ *   - 计分器（CustomScorer）的命中和直方图记在处理该批的线程和事件中，不并入源事件的命中集合；
+ *     CSV、相空间文件和步数统计按上述方式合并，与处理批的线程无关。
+ */
+class OpticalPhotonScheduler {
+public:
+    // 一批光子的结果，处理批时能量沉积、步数和相空间记录写入这里而不是当前事件
+    struct BatchResult {
+        std::vector<G4double> deposits;                 // 各层能量沉积，顺序与层快照相同
+        std::vector<std::vector<PrimaryRecord>> crossings; // 各相空间平面的记录
+        G4long steps = 0;
+        G4long opticalSteps = 0;
+        G4String abortReason;                           // 批被中止的原因，未中止时为空
+
+        void CountStep(G4bool opticalPhoton) { steps++; if (opticalPhoton) opticalSteps++; }
+    };
+
+    // Tasking运行管理器下不能分批，给出警告并保持关闭
+    static void SetBatchSize(G4int photons);
+    static G4int GetBatchSize() { return fBatchSize; }
+    static G4bool IsEnabled() { return fBatchSize > 0; }
+
+    // 工作线程run开始时调用
+    static void BeginOfRun();
+    // 工作线程处理完分到的事件后在EndOfRunAction中调用，处理其他线程的批直到所有线程都结束事件循环
+    static void HelpUntilRunEnd();
+
+    // 事件开始时清空本线程的光子（StackingAction::PrepareNewEvent）
+    static void PrepareNewEvent();
+
+    // 带电粒子阶段产生的光学光子暂存起来，返回true时调用者删除该径迹
+    static G4bool Collect(const G4Track* track);
+
+    // 由StackingAction::NewStage调用：分批、压入本事件的下一批或等待其他线程处理完
+    static void NewStage();
+
+    // 本事件各批的结果，按批的顺序；在EndOfEventAction中调用一次
+    static std::vector<BatchResult> TakeResults();
+
+    // 当前线程正在处理的批，不在批中时返回nullptr
+    static BatchResult* GetCurrentBatch() { return fCurrentBatch; }
+
+    // 当前事件是为其他线程处理光子批的事件，不写入输出
+    static G4bool IsHelperEvent() { return fHelping; }
+
+private:
+    struct Photon {
+        G4ThreeVector position;
+        G4ThreeVector direction;
+        G4ThreeVector polarization;
+        G4double energy;
+        G4double time;
+        G4double weight;
+        G4int parentID;
+        G4int creator;      // Work::creators中的序号，-1表示没有产生过程
+        G4int trackInfo;    // Work::trackInfos中的序号，-1表示没有MyTrackInfo
+    };
+
+    // 一个事件交出的所有批
+    struct Work {
+        G4int eventID = 0;
+        std::uint64_t seed = 0;             // 事件的辅助种子，派生各批的种子
+        std::vector<Photon> photons;
+        std::vector<G4String> creators;     // 产生过程的名称，各线程按名称找到自己的过程
+        std::vector<std::shared_ptr<const MyTrackInfo>> trackInfos; // 光子的层标记，相邻光子相同的只存一份
+        size_t batchSize = 0;
+        std::vector<BatchResult> results;
+        // 以下由fMutex保护
+        size_t nextBatch = 0;
+        size_t nDone = 0;
+    };
+
+    // 每个线程的状态
+    struct ThreadState {
+        std::vector<Photon> photons;
+        std::vector<G4String> creators;
+        std::map<const G4VProcess*, G4int> creatorIndex;
+        std::vector<std::shared_ptr<const MyTrackInfo>> trackInfos;
+        std::shared_ptr<Work> work;     // 本线程交出的事件，或正在为其处理批的事件
+        G4int batch = -1;
+        G4bool stacked = false;         // 帮助其他线程时，批的光子已压入堆栈
+    };
+
+    static ThreadState& GetState();
+    static void Dispatch(ThreadState& state);
+    static void StackBatch(Work& work, size_t batch);
+    static void ProcessBatch(const std::shared_ptr<Work>& work, size_t batch);
+    static void Complete(Work& work);
+    static void Cancel(ThreadState& state);
+
+    static G4int fBatchSize;
+
+    static std::mutex fMutex;
+    static std::condition_variable fCondition;
+    static std::deque<std::shared_ptr<Work>> fQueue;  // 还有未被取走的批的事件
+    static G4int fActiveWorkers;                      // 仍在事件循环中的工作线程数
+
+    static G4ThreadLocal ThreadState* fState;
+    static G4ThreadLocal BatchResult* fCurrentBatch;
+    static G4ThreadLocal G4bool fHelping;
+};
+
+#endif
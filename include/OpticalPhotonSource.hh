@@ -0,0 +1,75 @@
+#ifndef OpticalPhotonSource_hh
+#define OpticalPhotonSource_hh 1
+
+#include <vector>
+
+#include "globals.hh"
+#include "G4ThreeVector.hh"
+#include "G4Transform3D.hh"
+#include "G4TrackVector.hh"
+
+class G4Event;
+class G4VSolid;
+class CompScintSimDetectorConstruction;
+
+/**
+ * @brief 分块发射的光学光子源
+ *
+ * 在指定的 scint_layer_N 体积内均匀抽样发光点，能谱取该层材料的
+ * SCINTILLATIONCOMPONENT1，方向各向同性，偏振随机。
+ * 每个事件的光子分块产生：第一块作为初级粒子放入事件，其余各块在堆栈
+ * 清空时（StackingAction::NewStage）再压入，堆栈中同时存在的光子数不超过块大小。
+ *
+ * 光子分批并行处理（OpticalPhotonScheduler）打开时，事件的光子在第一次
+ * NewStage时全部产生并交给调度器，不再分块压入堆栈。
+ */
+class OpticalPhotonSource {
+public:
+    OpticalPhotonSource();
+    ~OpticalPhotonSource() = default;
+
+    void SetLayer(G4int copynumber) { fLayerID = copynumber; fInitialized = false; }
+    // 几何重建后重新读取发光体积
+    void Reset() { fInitialized = false; }
+    void SetPhotonsPerEvent(G4long nPhotons) { fPhotonsPerEvent = nPhotons; }
+    void SetChunkSize(G4int chunkSize) { fChunkSize = chunkSize; }
+    // 材料未定义发射谱时使用的单色能量
+    void SetFallbackEnergy(G4double energy) { fFallbackEnergy = energy; }
+
+    G4int GetLayer() const { return fLayerID; }
+    G4long GetPhotonsPerEvent() const { return fPhotonsPerEvent; }
+    G4int GetChunkSize() const { return fChunkSize; }
+
+    // 开始新事件：产生第一块光子作为初级粒子
+    void GeneratePrimaries(G4Event* event, const CompScintSimDetectorConstruction* detector);
+
+    // 本事件尚未发射的光子数
+    G4long GetPendingPhotons() const { return fPending; }
+
+    // 产生下一块光子（由StackingAction调用），返回产生的数目
+    G4int FillNextChunk(G4TrackVector& tracks);
+
+private:
+    void Initialize(const CompScintSimDetectorConstruction* detector);
+    void SamplePhoton(G4ThreeVector& position, G4ThreeVector& direction,
+                      G4ThreeVector& polarization, G4double& energy) const;
+
+    G4int fLayerID;
+    G4long fPhotonsPerEvent;
+    G4int fChunkSize;
+    G4double fFallbackEnergy;
+
+    G4bool fInitialized;
+    G4long fPending;
+
+    // 发光体积（局部坐标）及其到世界坐标的变换
+    const G4VSolid* fSolid;
+    G4ThreeVector fLocalMin, fLocalMax;
+    G4Transform3D fTransform;
+
+    // 发射谱的累积分布（按能量线性插值）
+    std::vector<G4double> fSpectrumEnergy;
+    std::vector<G4double> fSpectrumCDF;
+};
+
+#endif
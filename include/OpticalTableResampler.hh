@@ -0,0 +1,51 @@
+#ifndef OpticalTableResampler_hh
+#define OpticalTableResampler_hh 1
+
+#include "globals.hh"
+#include "G4MaterialPropertyVector.hh"
+
+class G4Material;
+
+/**
+ * @brief 光学性质表的均匀网格重采样
+ *
+ * 光学光子输运中大部分时间花在G4MaterialPropertyVector::Value对不规则能量点的二分查找上。
+ * 在材料构建时把RINDEX、ABSLENGTH、RAYLEIGH、WLSABSLENGTH和发射谱
+ * (SCINTILLATIONCOMPONENT1/2/3, WLSCOMPONENT)重采样到均匀能量网格：
+ * 网格点数从原始点数开始加倍，直到在原始节点和各网格区间内的检查点上，
+ * 与原始表插值结果的最大偏差（相对于表中最大绝对值）不超过容差。
+ * 新表开启对数分箱查找，每个查找分箱不超过一个网格间距，查找不再需要二分。
+ *
+ * 容差为0（默认）时不做重采样。
+ */
+class OpticalTableResampler {
+public:
+    // 容差须在材料构建之前设置，0表示关闭
+    static void SetTolerance(G4double tolerance) { fTolerance = tolerance; }
+    static G4double GetTolerance() { return fTolerance; }
+
+    /**
+     * @brief 对材料的光学性质表重采样并输出每张表的点数和最大插值误差
+     *
+     * @return G4double 本材料各表的最大相对误差，未重采样时为0
+     */
+    static G4double Resample(G4Material* material);
+
+    // 已重采样的所有表中的最大相对误差
+    static G4double GetMaxError() { return fMaxError; }
+
+private:
+    // 重采样单张表，返回新表（调用者负责所有权），不需要重采样时返回nullptr
+    static G4MaterialPropertyVector* ResampleVector(const G4MaterialPropertyVector* vector,
+                                                    G4double& maxError);
+
+    // 均匀网格上线性插值与原始表之间的最大相对误差
+    static G4double MaxError(const G4MaterialPropertyVector* vector,
+                             const std::vector<G4double>& values,
+                             G4double eMin, G4double step);
+
+    static G4double fTolerance;
+    static G4double fMaxError;
+};
+
+#endif
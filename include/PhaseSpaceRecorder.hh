@@ -0,0 +1,78 @@
+#ifndef PhaseSpaceRecorder_hh
+#define PhaseSpaceRecorder_hh 1
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "globals.hh"
+#include "PrimaryFile.hh"
+
+class G4Step;
+
+/**
+ * @brief 层间相空间记录器
+ *
+ * 在若干z平面上记录向下穿过的粒子（种类、能量、位置、方向、时间、权重），
+ * 每条径迹在每个平面只记录第一次向下穿过，被背散射后再次穿过平面的不重复记录，
+ * 以免从该平面重新开始时同一粒子被模拟两次。
+ * 每个平面写一个与初级粒子文件相同格式的文件，可用
+ * /CompScintSim/generator/source phasespace 从该平面重新开始模拟。
+ * 每个线程的RunAction持有一个实例；一个事件的记录先缓存，事件结束时只写出未被中止的事件，
+ * 各线程写临时文件，由主线程合并。
+ */
+class PhaseSpaceRecorder {
+public:
+    PhaseSpaceRecorder();
+    ~PhaseSpaceRecorder() = default;
+
+    // 输出文件名，第i个平面写入 <文件名>_plane<i><后缀>；为空时不记录
+    void SetFileName(const G4String& fileName) { fFileName = fileName; }
+    const G4String& GetFileName() const { return fFileName; }
+
+    // 平面可以直接给出z坐标，也可以取某层下表面（运行开始时由几何确定）
+    void AddPlane(G4double z) { fPlanes.push_back({z, 0}); }
+    void AddPlaneBelowLayer(G4int copynumber) { fPlanes.push_back({0., copynumber}); }
+    void ClearPlanes() { fPlanes.clear(); }
+
+    // 记录后终止粒子，用于只需要生成相空间文件的运行
+    void SetKillAtPlane(G4bool kill) { fKillAtPlane = kill; }
+
+    G4bool IsEnabled() const { return !fFileName.empty() && !fPlanes.empty(); }
+    G4bool IsRecording() const { return !fWriters.empty(); }
+    size_t GetNumberOfPlanes() const { return fPlanes.size(); }
+
+    // 运行开始时确定各平面的z坐标，openFiles为真时打开本线程的临时文件
+    void BeginOfRun(G4int threadID, G4bool openFiles);
+    void EndOfRun();
+
+    // 事件开始时清空已记录的径迹和缓存的记录
+    void BeginOfEvent();
+    // 事件结束时写出缓存的记录，被中止的事件丢弃
+    void EndOfEvent(G4bool aborted);
+
+    // 由SteppingAction在每一步调用
+    void ProcessStep(const G4Step* step);
+
+    // 加入本事件光子批的记录（OpticalPhotonScheduler），每个平面一组
+    void AddRecords(const std::vector<std::vector<PrimaryRecord>>& crossings);
+
+    G4String GetPlaneFileName(size_t plane) const;
+    G4String GetPartFileName(G4int threadID, size_t plane) const;
+
+private:
+    struct Plane {
+        G4double z;
+        G4int belowLayer;   // >0时z取该层下表面
+    };
+
+    G4String fFileName;
+    std::vector<Plane> fPlanes;
+    std::vector<G4double> fPlaneZ;
+    std::vector<std::unique_ptr<PrimaryFileWriter>> fWriters;
+    std::vector<std::unordered_set<G4int>> fRecordedTracks; // 每个平面本事件已记录的trackID
+    std::vector<std::vector<PrimaryRecord>> fEventRecords;  // 每个平面本事件的记录
+    G4bool fKillAtPlane;
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef PhysicsTableCache_hh
+#define PhysicsTableCache_hh 1
+
+#include "globals.hh"
+
+#include <cstdint>
+
+class G4VUserPhysicsList;
+
+/**
+ * @brief 物理表的磁盘缓存
+ *
+ * 短的运行（几百个事件）中建立电磁和强子物理表占了大部分墙钟时间。
+ * 启用缓存后，首次建立的物理表用StorePhysicsTable写入 <缓存目录>/<键>/，
+ * 之后以相同配置启动时用SetPhysicsTableRetrieved从中读取。
+ * 键为物理列表预设、光学设置、各区域的产生阈值、材料组成和Geant4版本的哈希，
+ * 任何一项变化都会使用新的子目录，即重新建立物理表。
+ *
+ * 缓存目录由 /CompScintSim/physics/tableCache（PreInit状态）或环境变量
+ * COMPSCINTSIM_PHYSICS_CACHE 指定，为空时不启用。只在主线程使用。
+ */
+class PhysicsTableCache {
+public:
+    enum Status { kDisabled, kCold, kWarm };
+
+    static void SetDirectory(const G4String& directory);
+    static const G4String& GetDirectory();
+
+    /**
+     * @brief 在物理表建立之前（SetCuts之后）调用，命中缓存时让物理列表读取物理表
+     *
+     * @param physicsList 物理列表
+     * @param config 物理列表的配置（预设和光学设置），参与哈希
+     */
+    static void Prepare(G4VUserPhysicsList* physicsList, const G4String& config);
+
+    // 物理表建立之后调用，未命中缓存时写入缓存
+    static void Store();
+
+    static Status GetStatus() { return fStatus; }
+    static const char* GetStatusName();
+
+private:
+    // 配置、产生阈值和材料的哈希
+    static std::uint64_t Hash(const G4String& config);
+
+    static G4String fDirectory;
+    static G4String fEntry;          // 本次配置对应的子目录
+    static Status fStatus;
+    static G4VUserPhysicsList* fPhysicsList;
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef PrimaryFile_hh
+#define PrimaryFile_hh 1
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "globals.hh"
+
+class G4Event;
+class G4ParticleDefinition;
+
+/**
+ * @brief 初级粒子文件格式（二进制，小端）
+ *
+ * [PrimaryFileHeader]
+ * [uint64 eventOffsets[nEvents + 1]]   每个事件第一条记录的序号，最后一项为nRecords
+ * [PrimaryRecord records[nRecords]]    按eventID排序
+ *
+ * 同一格式既用于初级粒子的转储/重放，也用于层间相空间文件。
+ */
+struct PrimaryFileHeader {
+    char magic[8];            // "CSSPRIM1"
+    uint32_t version;         // 格式版本
+    uint32_t recordSize;      // sizeof(PrimaryRecord)，用于校验
+    uint64_t nEvents;         // 文件中的事件数
+    uint64_t nRecords;        // 文件中的记录数
+    uint64_t nSourceEvents;   // 产生该文件的原始运行的事件数（用于归一化）
+};
+
+struct PrimaryRecord {
+    int32_t eventID;          // 原始事件号
+    int32_t particleCode;     // PDG编码（光学光子见PrimaryFileReader::EncodeParticle）
+    double energy;            // 动能 (MeV)
+    double x, y, z;           // 位置 (mm)
+    double dx, dy, dz;        // 单位方向
+    double time;              // 全局时间 (ns)
+    double weight;            // 权重
+};
+
+static_assert(sizeof(PrimaryFileHeader) == 40, "unexpected PrimaryFileHeader layout");
+static_assert(sizeof(PrimaryRecord) == 80, "unexpected PrimaryRecord layout");
+
+/**
+ * @brief 线程局部的记录写入器
+ *
+ * 每个线程将记录追加到自己的临时文件，运行结束时由主线程调用Merge
+ * 按eventID排序并生成带事件索引的最终文件。
+ */
+class PrimaryFileWriter {
+public:
+    PrimaryFileWriter();
+    ~PrimaryFileWriter();
+
+    bool Open(const G4String& partFileName);
+    void Close();
+    bool IsOpen() const { return fOut.is_open(); }
+
+    void Write(const PrimaryRecord& record);
+
+    // 写入事件的所有初级粒子
+    void WriteEvent(const G4Event* event);
+
+    // 合并各线程的临时文件，返回写入的记录数；临时文件会被删除
+    // 输出文件已存在时被覆盖，保证重放命令使用的文件名总是指向最近一次运行的结果
+    static G4long Merge(const std::vector<G4String>& partFileNames,
+                        const G4String& outputFileName,
+                        G4long nSourceEvents);
+
+private:
+    std::ofstream fOut;
+};
+
+/**
+ * @brief 内存映射的只读记录文件
+ *
+ * 同一路径的文件在进程内只映射一次，由所有工作线程共享，读取无需加锁。
+ */
+class PrimaryFileReader {
+public:
+    static std::shared_ptr<const PrimaryFileReader> Open(const G4String& fileName);
+    ~PrimaryFileReader();
+
+    G4int GetNumberOfEvents() const { return static_cast<G4int>(fHeader->nEvents); }
+    G4long GetNumberOfRecords() const { return static_cast<G4long>(fHeader->nRecords); }
+    G4long GetNumberOfSourceEvents() const { return static_cast<G4long>(fHeader->nSourceEvents); }
+    const G4String& GetFileName() const { return fFileName; }
+
+    // 获取第index个事件的记录
+    const PrimaryRecord* GetEventRecords(G4int index, G4int& nRecords) const;
+
+    // 按原始事件号查找记录，文件中没有该事件时返回nullptr
+    const PrimaryRecord* FindEvent(G4int eventID, G4int& nRecords) const;
+
+    // 将记录作为初级顶点加入事件，每条记录一个顶点，顶点权重取记录权重
+    static void AddToEvent(G4Event* event, const PrimaryRecord* records, G4int nRecords);
+
+    static G4int EncodeParticle(const G4ParticleDefinition* particle);
+    static G4ParticleDefinition* DecodeParticle(G4int particleCode);
+
+private:
+    explicit PrimaryFileReader(const G4String& fileName);
+
+    G4String fFileName;
+    void* fData;
+    size_t fSize;
+    const PrimaryFileHeader* fHeader;
+    const uint64_t* fEventOffsets;
+    const PrimaryRecord* fRecords;
+};
+
+#endif
@@ -1,8 +1,11 @@
 #ifndef ScintillatorLayerManager_hh
 #define ScintillatorLayerManager_hh 1
 
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <string>
 #include <fstream>
 #include <sstream>
@@ -13,6 +16,8 @@
 #include "G4Exception.hh"
 
 class MaterialManager;
+class G4VPhysicalVolume;
+class G4VTouchable;
 
 // 定义一个结构体来存储闪烁体层的所有参数
 struct ScintillatorLayerInfo {
@@ -27,10 +32,14 @@ struct ScintillatorLayerInfo {
     G4String coating_material;       // coating材料名称
     G4double fiber_core_diameter;    // 光纤芯直径(um)
     G4double fiber_cladding_diameter;// 光纤包层直径(um)
+    G4double production_cut;         // 闪烁体区域的次级粒子产生阈值(mm)，可选列，<=0表示使用默认值
     
     // 获取材料实例的便捷方法
     G4Material* GetScintMaterial() const;
     G4Material* GetCoatingMaterial() const;
+
+    // 除copynumber外所有参数都相同（可以共用逻辑体复制放置）
+    bool HasSameDefinition(const ScintillatorLayerInfo& other) const;
     
     // 获取转换为正确单位的参数
     G4double GetScintLengthMM() const { return scint_length * mm; }
@@ -39,6 +48,29 @@ struct ScintillatorLayerInfo {
     G4double GetCoatingThicknessNM() const { return coating_thickness * nm; }
     G4double GetFiberCoreDiameterUM() const { return fiber_core_diameter * um; }
     G4double GetFiberCladdingDiameterUM() const { return fiber_cladding_diameter * um; }
+    G4double GetProductionCutMM() const { return production_cut * mm; }
+};
+
+// 冻结的层参数快照：各层的数值参数按稠密层下标（copynumber-1）连续存放（结构数组），
+// 长度已换算为Geant4内部单位。由主线程在Initialize()中构建后不再修改，工作线程无锁只读
+struct LayerSnapshot {
+    std::vector<G4int> copynumber;
+    std::vector<G4int> readoutFace;
+    std::vector<G4double> lightYield;
+    std::vector<G4double> scintLength;
+    std::vector<G4double> scintWidth;
+    std::vector<G4double> scintHeight;
+    std::vector<G4double> coatingThickness;
+    std::vector<G4double> fiberCoreDiameter;
+    std::vector<G4double> fiberCladdingDiameter;
+    std::vector<G4double> productionCut;
+
+    size_t Size() const { return copynumber.size(); }
+
+    // copynumber是从1开始的连续整数（Initialize中检查），下标直接由copynumber得到，不存在时返回-1
+    G4int IndexOf(G4int cn) const {
+        return (cn >= 1 && cn <= static_cast<G4int>(copynumber.size())) ? cn - 1 : -1;
+    }
 };
 
 // 闪烁体层参数管理类 - 全局单例类，用于管理从CSV文件读取的参数
@@ -47,8 +79,12 @@ public:
     // 获取单例实例
     static ScintillatorLayerManager& GetInstance();
     
-    // 从CSV文件初始化
+    // 从CSV文件初始化，只能在主线程中调用（程序启动时和重新载入几何时）
     bool Initialize(const G4String& filename);
+
+    // 当前的层参数快照，工作线程中只应使用此接口。几何重新载入后返回新的快照，
+    // 旧快照在程序结束前一直有效，可以用地址判断快照是否已更换
+    const LayerSnapshot& GetSnapshot() const { return *m_snapshot.load(std::memory_order_acquire); }
     
     // 获取特定copynumber的层信息
     const ScintillatorLayerInfo* GetLayerInfo(G4int copynumber) const;
@@ -67,6 +103,15 @@ public:
     
     // 获取所有层的信息
     const std::map<G4int, ScintillatorLayerInfo>& GetAllLayerInfo() const;
+
+    // 登记层的物理体，用于由touchable查找所在层。单独放置的层登记一个copynumber，
+    // 复制放置（G4PVReplica）的层片按复制编号顺序登记各层的copynumber
+    void RegisterLayerVolume(const G4VPhysicalVolume* volume, const std::vector<G4int>& copynumbers);
+    void ClearLayerVolumes();
+
+    // 由touchable查找所在层的copynumber：从当前体积向上找到登记过的物理体，
+    // 复制放置的层由复制编号直接索引。不在任何登记的层内时返回-1
+    G4int GetLayerCopynumber(const G4VTouchable* touchable) const;
     
 private:
     // 私有构造函数（单例模式）
@@ -82,6 +127,9 @@ private:
     std::map<G4int, ScintillatorLayerInfo> m_layerInfoMap; // 存储每个层的信息，按copynumber索引
     std::vector<G4int> m_copynumbers;                      // 按顺序存储copynumber列表
     G4double m_totalStackHeight;                           // 所有层的总高度（包含gaps）
+    std::vector<std::unique_ptr<const LayerSnapshot>> m_snapshots; // 所有构建过的快照，保证旧快照的地址有效
+    std::atomic<const LayerSnapshot*> m_snapshot;          // 当前快照
+    std::unordered_map<const G4VPhysicalVolume*, std::vector<G4int>> m_layerVolumes; // 登记的层物理体，几何构建后只读
 };
 
 #endif // ScintillatorLayerManager_hh 
\ No newline at end of file
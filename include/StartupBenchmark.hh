@@ -0,0 +1,58 @@
+#ifndef StartupBenchmark_hh
+#define StartupBenchmark_hh 1
+
+#include "globals.hh"
+#include "G4Timer.hh"
+#include "G4VStateDependent.hh"
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 启动开销统计
+ *
+ * 监听应用状态变化，记录初始化（PreInit→Idle）和首次beamOn建立物理表
+ * （Idle→Init→Idle）两个阶段的耗时；几何、材料、重叠检查和灵敏探测器的构建
+ * 由各自的代码通过RecordPhase登记，工作线程的启动耗时由MarkRunStart得到。
+ * 第一个run结束时输出启动时间线、常驻内存（VmRSS）、元素数和材料数，
+ * 用于比较材料/几何改动前后的启动开销。
+ * 只在主线程创建，由G4StateManager在程序结束时删除。
+ */
+class StartupBenchmark : public G4VStateDependent {
+public:
+    StartupBenchmark();
+    ~StartupBenchmark() override = default;
+
+    G4bool Notify(G4ApplicationState requestedState) override;
+
+    // 登记一个阶段的耗时（s），同名阶段取最大值（如各工作线程并行构建灵敏探测器）
+    static void RecordPhase(const G4String& phase, G4double seconds);
+
+    // 各线程开始run时调用，只记录每个线程的第一个run
+    static void MarkRunStart();
+
+    // 在主线程第一个run结束时输出启动时间线，之后的调用不再输出
+    static void ReportTimeline();
+
+    // 程序启动以来的墙钟时间（s）
+    static G4double Elapsed();
+
+    // 当前进程的常驻内存（kB），无法读取/proc时返回-1
+    static G4long GetResidentMemory();
+
+private:
+    G4Timer fTimer;
+    G4int fInitPhase;          // 已完成的Init阶段数：1为初始化，2为物理表建立
+
+    static std::mutex fMutex;
+    static std::vector<std::pair<G4String, G4double>> fPhases; // 按登记顺序
+    static G4double fMasterRunStart;     // 主线程开始第一个run的时刻（s）
+    static G4double fWorkerRunStart;     // 最后一个工作线程开始第一个run的时刻（s）
+    static G4int fWorkers;               // 已开始run的工作线程数
+    static G4long fInitMemory;           // 初始化完成后的常驻内存（kB）
+    static G4long fPhysicsMemory;        // 物理表建立后的常驻内存（kB）
+    static G4bool fReported;
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef ThreadPinning_hh
+#define ThreadPinning_hh 1
+
+#include "globals.hh"
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief 工作线程绑定到CPU核
+ *
+ * 双路节点上工作线程在两个插槽之间迁移时，导航、光子堆栈和线程输出缓冲区等
+ * 线程状态要访问远端内存。启用绑定后，每个工作线程在创建线程状态之前
+ * （CompScintSimWorkerInitialization::WorkerInitialize，早于用户动作、几何和物理的
+ * 线程初始化）绑定到一个核，之后分配的线程状态按首次访问位于本地内存。
+ *
+ * 绑定策略（-pin 或 /MySim/pinThreads，PreInit状态）：
+ *   none     不绑定（默认）
+ *   compact  按插槽依次填满，同一插槽的线程相邻
+ *   scatter  在各插槽之间轮流分配
+ *   列表     如 0,2,4-7，第i个工作线程绑定到列表中第i个核（循环使用）
+ * 可用的核为进程当前的亲和性掩码，插槽和物理核由/sys/devices/system/cpu读取。
+ * 只在Linux上有效，其他平台上只输出警告。
+ */
+class ThreadPinning {
+public:
+    static void SetPolicy(const G4String& policy);
+    static const G4String& GetPolicy() { return fPolicy; }
+
+    // 在工作线程中调用，按策略绑定当前线程
+    static void PinCurrentThread();
+
+    // 输出线程到核的映射，只在主线程调用
+    static void Report();
+
+private:
+    // 按策略排列的可用核
+    static std::vector<G4int> OrderedCpus();
+
+    static G4String fPolicy;
+    static std::mutex fMutex;
+    static std::vector<G4int> fCpus;          // 按策略排列的核，第一次绑定时确定
+    static std::map<G4int, G4int> fThreadCpu; // 线程号 -> 核
+};
+
+#endif
@@ -16,8 +16,7 @@
 
 
 // switch
-inline G4bool g_has_opticalPhysics = false;  // 是否模拟光学过程
-inline G4bool g_has_cherenkov = false;       // 是否考虑切伦科夫光
+inline G4bool g_has_opticalPhysics = false;  // 是否模拟光学过程的默认值，运行时由 -physics optical|nooptical 选择
 
 // 光学表面
 inline G4OpticalSurface *g_surf_Teflon = MyMaterials::surf_Teflon();
@@ -28,6 +27,9 @@ inline G4double g_worldY = 20 * cm;
 inline G4double g_worldZ = 20 * cm;
 inline G4Material *g_world_material = MyMaterials::Vacuum();
 
+// material
+inline G4String g_material_database = "materials.txt"; // 材料数据库文本源，编译后的二进制文件为同名.matdb
+
 // scintillator
 inline G4String g_ScintillatorGeometry = "ScintillatorGeometry.csv";
 inline G4double g_scint_layer_gap = 0 * mm;
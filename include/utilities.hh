@@ -7,6 +7,7 @@
 #include <vector>
 #include <cstdio>
 #include <cstdarg>
+#include <cstdint>
 #include "config.hh"
 
 // 辅助函数，用于将任意类型转换为字符串
@@ -24,8 +25,14 @@ enum LogLevel {
     ERROR   // 错误信息
 };
 
-// 根据g_debug_mode自动设置全局日志级别
-inline LogLevel lv = g_debug_mode ? DEBUG : INFO;    
+// 编译期最低日志级别，低于该级别的myPrint调用连同其参数的格式化一起被删除
+// Release构建中定义为1（INFO），见CMakeLists.txt
+#ifndef COMPSCINTSIM_MIN_LOG_LEVEL
+#define COMPSCINTSIM_MIN_LOG_LEVEL 0
+#endif
+
+// 运行期日志级别，由InitializeLogLevel()在解析命令行参数后根据g_debug_mode设置
+inline LogLevel lv = INFO;
 
 // C风格格式化函数 (printf风格，使用 %d, %f 等)
 std::string f(const char* format, ...);
@@ -50,13 +57,28 @@ std::string fmt(const std::string& format, Args... args) {
     return result;
 }
 
-// 打印日志函数
-void myPrint(LogLevel level, const std::string& message);
+// 写入一条日志：先写入线程局部缓冲区，缓冲区满、ERROR级别或调用FlushLog()时统一输出
+void LogMessage(LogLevel level, const std::string& message);
+
+// 输出当前线程缓冲的日志
+void FlushLog();
+
+// 打印日志：级别检查在参数求值之前，被过滤的日志不会执行fmt/f格式化
+#define myPrint(level, message)                                   \
+    do {                                                          \
+        if constexpr ((level) >= COMPSCINTSIM_MIN_LOG_LEVEL) {    \
+            if ((level) >= lv) {                                  \
+                LogMessage((level), (message));                   \
+            }                                                     \
+        }                                                         \
+    } while (0)
 
-// 初始化日志级别函数
+// 初始化日志级别函数，须在设置g_debug_mode之后调用
 void InitializeLogLevel();
 
-// 全局日志级别变量在utilities.cc中定义
+// FNV-1a哈希，把data累加到hash上，用于几何和物理表缓存的键
+const std::uint64_t kHashOffset = 14695981039346656037ULL;
+std::uint64_t HashBytes(const std::string& data, std::uint64_t hash = kHashOffset);
 
 
 #endif // UTILITIES_HH
\ No newline at end of file
@@ -65,7 +65,7 @@ void CompScintSimActionInitialization::Build() const
   CompScintSimEventAction* event = new CompScintSimEventAction(runAction);
   SetUserAction(event);
   
-  SetUserAction(new CompScintSimSteppingAction(event));
+  SetUserAction(new CompScintSimSteppingAction(event, runAction));
   SetUserAction(new MyTrackingAction());
-  SetUserAction(new CompScintSimStackingAction());
+  SetUserAction(new CompScintSimStackingAction(primary));
 }
@@ -1,10 +1,15 @@
 #include <vector>
+#include <algorithm>
+#include <memory>
 
 #include "CompScintSimDetectorConstruction.hh"
 #include "CompScintSimDetectorMessenger.hh"
 #include "CompScintSimLayerSensitiveDetector.hh"
+#include "GeometryValidator.hh"
+#include "LayerDispatchDetector.hh"
 #include "MaterialManager.hh"
 #include "ScintillatorLayerManager.hh"
+#include "StartupBenchmark.hh"
 
 #include "G4Element.hh"
 #include "G4GDMLParser.hh"
@@ -18,10 +23,20 @@
 #include "G4ThreeVector.hh"
 #include "G4VisAttributes.hh"
 #include "G4SubtractionSolid.hh"
+#include "G4PVReplica.hh"
 #include "G4UnionSolid.hh"
 #include "G4AssemblyVolume.hh"
 
 #include "G4GlobalMagFieldMessenger.hh"
+#include "G4GeometryManager.hh"
+#include "G4PhysicalVolumeStore.hh"
+#include "G4LogicalVolumeStore.hh"
+#include "G4ProductionCuts.hh"
+#include "G4ProductionCutsTable.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4SolidStore.hh"
+#include "G4RunManager.hh"
 #include "G4SDManager.hh"
 #include "G4SDChargedFilter.hh"
 #include "G4MultiFunctionalDetector.hh"
@@ -29,6 +44,7 @@
 #include "G4PSEnergyDeposit.hh"
 #include "G4Exception.hh"
 #include "G4AnalysisManager.hh"
+#include "G4Timer.hh"
 
 #include "MyMaterials.hh"
 #include "MyPhysicalVolume.hh"
@@ -46,6 +62,10 @@ CompScintSimDetectorConstruction::CompScintSimDetectorConstruction()
   fDumpGdmlFileName = "LightCollecion.gdml";
   fVerbose = false;  // 是否输出详细信息
   fDumpGdml = false; // 是否保存GDML的几何文件
+  fBooleanFreeLayers = false; // 是否用基本体代替布尔体构建层
+  fSurfaceCoatingThreshold = 0; // 比该厚度薄的coating只用光学表面表示，0表示不启用
+  fReplicateLayers = false; // 是否复制放置相同定义的连续层
+  fOverlapCheck = "auto"; // 重叠检查模式，见GeometryValidator
   // create a messenger for this class
   fDetectorMessenger = new CompScintSimDetectorMessenger(this);
 }
@@ -59,7 +79,12 @@ CompScintSimDetectorConstruction::~CompScintSimDetectorConstruction()
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 G4VPhysicalVolume *CompScintSimDetectorConstruction::Construct()
 {
-  G4bool checkOverlaps = true;
+  G4bool checkOverlaps = false; // 重叠检查在几何构建完成后由GeometryValidator统一进行
+
+  // 启动时间线：几何构建时间中扣除材料构建
+  G4Timer timer;
+  timer.Start();
+  G4double materialTime = MaterialManager::GetBuildTime();
 
   // ------------- Volumes --------------
   // s_ for soild_
@@ -88,9 +113,13 @@ G4VPhysicalVolume *CompScintSimDetectorConstruction::Construct()
   const std::vector<G4int> &copynumbers = layerManager.GetCopynumbers();
 
   // 反向迭代copynumbers，确保从上到下的顺序处理
-  for (auto it = copynumbers.rbegin(); it != copynumbers.rend(); ++it)
+  std::vector<G4int> stack_order(copynumbers.rbegin(), copynumbers.rend());
+  layerManager.ClearLayerVolumes();
+  fReplicatedLayerRuns.clear();
+  fReplicaFrames.clear();
+  for (size_t i = 0; i < stack_order.size();)
   {
-    G4int copynumber = *it;
+    G4int copynumber = stack_order[i];
     const ScintillatorLayerInfo *layerInfo = layerManager.GetLayerInfo(copynumber);
 
     if (!layerInfo)
@@ -99,13 +128,33 @@ G4VPhysicalVolume *CompScintSimDetectorConstruction::Construct()
       ed << "Failed to get layer info for copynumber " << copynumber;
       G4Exception("CompScintSimDetectorConstruction::Construct",
                   "LayerNotFound", FatalException, ed);
+      i++;
       continue;
     }
 
-    G4cout << "Creating layer " << copynumber << " scintillator detector..." << G4endl;
-
     // 计算层的放置位置
     G4double layer_height = layerInfo->GetScintHeightMM() + 2 * layerInfo->GetCoatingThicknessNM();
+
+    // 相同定义的连续层复制放置
+    std::vector<G4int> run(1, copynumber);
+    if (fReplicateLayers)
+    {
+      while (i + run.size() < stack_order.size())
+      {
+        const ScintillatorLayerInfo *next = layerManager.GetLayerInfo(stack_order[i + run.size()]);
+        if (!next || !next->HasSameDefinition(*layerInfo)) break;
+        run.push_back(stack_order[i + run.size()]);
+      }
+    }
+    if (run.size() > 1 && BuildReplicatedLayers(run, p_world, z_position))
+    {
+      z_position += run.size() * (layer_height + g_scint_layer_gap);
+      i += run.size();
+      continue;
+    }
+
+    G4cout << "Creating layer " << copynumber << " scintillator detector..." << G4endl;
+
     G4ThreeVector layer_position = G4ThreeVector(0, 0, z_position + 0.5 * layer_height);
 
     // 构建闪烁体探测器层
@@ -127,9 +176,15 @@ G4VPhysicalVolume *CompScintSimDetectorConstruction::Construct()
     // 添加到体积映射
     G4String phys_name = "Layer_" + std::to_string(copynumber) + "_phys";
     fVolumeMap[phys_name] = p_layer;
+    SetLayerRegion(copynumber, layerInfo->GetProductionCutMM());
+
+    // 登记层和光纤，用于由touchable查找所在层
+    layerManager.RegisterLayerVolume(p_layer, {copynumber});
+    layerManager.RegisterLayerVolume(fVolumeMap["fiber_cladding_" + std::to_string(copynumber)], {copynumber});
 
     // 更新z位置用于下一层
     z_position += layer_height + g_scint_layer_gap;
+    i++;
   }
 
   G4cout << "Multi-layer scintillator detector construction complete, total z-position: 0 - " << z_position << " mm" << G4endl;
@@ -141,6 +196,20 @@ G4VPhysicalVolume *CompScintSimDetectorConstruction::Construct()
     std::cout << "Volume name: " << pair.first << ", Volume address: " << pair.second << std::endl;
   }
 
+  // 重叠检查，几何CSV文件和下列配置都未变化时使用缓存的结果
+  G4String geometryConfig = fmt("world {} {} {} gap {} hole {} lg {} booleanFree {} surfaceCoating {} replicate {}",
+                                g_worldX, g_worldY, g_worldZ, g_scint_layer_gap, g_hole_diameter_ratio, g_lg_length,
+                                fBooleanFreeLayers, fSurfaceCoatingThreshold, fReplicateLayers);
+  timer.Stop();
+  materialTime = MaterialManager::GetBuildTime() - materialTime;
+  StartupBenchmark::RecordPhase("Geometry", timer.GetRealElapsed() - materialTime);
+  StartupBenchmark::RecordPhase("Materials", materialTime);
+
+  timer.Start();
+  GeometryValidator::Check(p_world, g_ScintillatorGeometry, geometryConfig, fOverlapCheck);
+  timer.Stop();
+  StartupBenchmark::RecordPhase("Overlap check", timer.GetRealElapsed());
+
   if (fDumpGdml)
   {
     std::ifstream ifile(fDumpGdmlFileName);
@@ -158,6 +227,36 @@ G4VPhysicalVolume *CompScintSimDetectorConstruction::Construct()
   return p_world;
 }
 
+/**
+ * @brief 两次运行之间重新载入几何
+ *
+ * 重新读取几何CSV文件，删除旧的物理体、逻辑体、实体和逻辑表面，
+ * 并通知运行管理器（包括各工作线程）在下一次beamOn时重新调用Construct()和ConstructSDandField()。
+ * 物理列表和已建立的物理表保留，只有新材料对应的物理表在下一次beamOn时补建。
+ * 光学表面属性（如g_surf_Teflon）在各次几何之间共用，不删除。
+ *
+ * @param fileName 几何CSV文件
+ */
+void CompScintSimDetectorConstruction::ReloadGeometry(const G4String &fileName)
+{
+  G4cout << "Reloading geometry from " << fileName << G4endl;
+
+  g_ScintillatorGeometry = fileName;
+  ScintillatorLayerManager::GetInstance().Initialize(fileName);
+
+  G4GeometryManager::GetInstance()->OpenGeometry();
+  G4PhysicalVolumeStore::GetInstance()->Clean();
+  G4LogicalVolumeStore::GetInstance()->Clean();
+  G4SolidStore::GetInstance()->Clean();
+  G4LogicalSkinSurface::CleanSurfaceTable();
+  G4LogicalBorderSurface::CleanSurfaceTable();
+  fVolumeMap.clear();
+  fReplicaFrames.clear();
+
+  // 旧几何已删除，不能让运行管理器再删除一次（其删除也会清空光学表面属性表）
+  G4RunManager::GetRunManager()->ReinitializeGeometry(false, true);
+}
+
 MyPhysicalVolume *CompScintSimDetectorConstruction::GetMyVolume(G4String volumeName) const
 {
   auto it = fVolumeMap.find(volumeName);
@@ -176,13 +275,65 @@ MyPhysicalVolume *CompScintSimDetectorConstruction::GetMyVolume(G4String volumeN
   }
 }
 
+VolumeFrame CompScintSimDetectorConstruction::GetVolumeFrame(const G4String &volumeName) const
+{
+  auto it = fReplicaFrames.find(volumeName);
+  if (it != fReplicaFrames.end())
+  {
+    return it->second;
+  }
+
+  MyPhysicalVolume *volume = GetMyVolume(volumeName);
+  VolumeFrame frame;
+  frame.logical = volume->GetLogicalVolume();
+  frame.position = volume->GetAbsolutePosition();
+  frame.rotation = *volume->GetAbsoluteRotation();
+  return frame;
+}
+
 void CompScintSimDetectorConstruction::ConstructSDandField()
 {
-  G4SDManager::GetSDMpointer()->SetVerboseLevel(1);
+  G4Timer timer;
+  timer.Start();
+
+  G4SDManager *sdManager = G4SDManager::GetSDMpointer();
+  sdManager->SetVerboseLevel(1);
   G4VPrimitiveScorer *primitive;
 
-  ScintillatorLayerManager &layerManager = ScintillatorLayerManager::GetInstance();
-  std::vector<G4int> id_lists = layerManager.GetCopynumbers();
+  // 重新载入几何（ReloadGeometry）后再次调用时，同名的探测器已在G4SDManager中，
+  // 直接挂到新的逻辑体上，不重复创建
+  auto findDetector = [sdManager](const G4String &name)
+  {
+    return sdManager->FindSensitiveDetector(name, false);
+  };
+
+  // 复制放置的层共用逻辑体，由LayerDispatchDetector按复制编号把步转交给各层的探测器
+  std::map<G4int, std::pair<LayerDispatchDetector *, LayerDispatchDetector *>> dispatchers;
+  for (const auto &run : fReplicatedLayerRuns)
+  {
+    G4String first = std::to_string(run.front());
+    auto layerDispatch = dynamic_cast<LayerDispatchDetector *>(findDetector("scint_layer_replicas_" + first));
+    auto fiberDispatch = dynamic_cast<LayerDispatchDetector *>(findDetector("fiber_core_replicas_" + first));
+    if (!layerDispatch)
+    {
+      layerDispatch = new LayerDispatchDetector("scint_layer_replicas_" + first);
+      sdManager->AddNewDetector(layerDispatch);
+    }
+    if (!fiberDispatch)
+    {
+      fiberDispatch = new LayerDispatchDetector("fiber_core_replicas_" + first);
+      sdManager->AddNewDetector(fiberDispatch);
+    }
+    SetSensitiveDetector("scint_layer_" + first, layerDispatch);
+    SetSensitiveDetector("fiber_core_" + first, fiberDispatch);
+    for (G4int id : run)
+    {
+      dispatchers[id] = {layerDispatch, fiberDispatch};
+    }
+  }
+
+  // 各工作线程都会调用，只读取层参数快照
+  const std::vector<G4int> &id_lists = ScintillatorLayerManager::GetInstance().GetSnapshot().copynumber;
   for (const auto &id : id_lists)
   {
     G4String layer_name = "scint_layer_" + std::to_string(id);
@@ -191,43 +342,63 @@ void CompScintSimDetectorConstruction::ConstructSDandField()
     // 使用目录结构命名
     G4String layerPrefix = "Layer_" + std::to_string(id) + "_";
 
-    auto layer = new G4MultiFunctionalDetector(layer_name);
-    auto fiber = new G4MultiFunctionalDetector(fiber_name);
-    G4SDManager::GetSDMpointer()->AddNewDetector(layer);
-    G4SDManager::GetSDMpointer()->AddNewDetector(fiber);
-
-    // 注册能量沉积探测器
-    primitive = new G4PSEnergyDeposit("TotalEnergy");
-    layer->RegisterPrimitive(primitive);
-
-    // 自上而下穿过该层的总能量的探测器(Truely，避免多次散射多次穿越时的重复统计)
-    primitive = new TruelyPassingEnergyScorer("TruelyPassingEnergy", layer_name);
-    layer->RegisterPrimitive(primitive);
-
-    // 注册光子探测器 - 闪烁光
-    primitive = new SCLightScorer("ScintillationPhotons", 
-                                  G4AnalysisManager::Instance()->GetH1Id(layerPrefix + "Scint"));
-    layer->RegisterPrimitive(primitive);
-
-    // 注册光子探测器 - 切伦科夫光
-    primitive = new CherenkovLightScorer("CherenkovPhotons", 
-                                        G4AnalysisManager::Instance()->GetH1Id(layerPrefix + "Chrnkv"));
-    layer->RegisterPrimitive(primitive);
+    auto layer = dynamic_cast<G4MultiFunctionalDetector *>(findDetector(layer_name));
+    if (!layer)
+    {
+      layer = new G4MultiFunctionalDetector(layer_name);
+      sdManager->AddNewDetector(layer);
+
+      // 注册能量沉积探测器
+      primitive = new G4PSEnergyDeposit("TotalEnergy");
+      layer->RegisterPrimitive(primitive);
+
+      // 自上而下穿过该层的总能量的探测器(Truely，避免多次散射多次穿越时的重复统计)
+      primitive = new TruelyPassingEnergyScorer("TruelyPassingEnergy", layer_name);
+      layer->RegisterPrimitive(primitive);
+
+      // 注册光子探测器 - 闪烁光
+      primitive = new SCLightScorer("ScintillationPhotons", 
+                                    G4AnalysisManager::Instance()->GetH1Id(layerPrefix + "Scint"));
+      layer->RegisterPrimitive(primitive);
+
+      // 注册光子探测器 - 切伦科夫光
+      primitive = new CherenkovLightScorer("CherenkovPhotons", 
+                                          G4AnalysisManager::Instance()->GetH1Id(layerPrefix + "Chrnkv"));
+      layer->RegisterPrimitive(primitive);
+
+      // // 注册光子探测器 - 进入NA的光子
+      // primitive = new FiberAcceptanceScorer("FiberNAPhotons", 
+      //                                      G4AnalysisManager::Instance()->GetH1Id(layerPrefix + "FiberNA"));
+      // layer->RegisterPrimitive(primitive);
+    }
 
-    SetSensitiveDetector(layer_name, layer);
-    
-    // // 注册光子探测器 - 进入NA的光子
-    // primitive = new FiberAcceptanceScorer("FiberNAPhotons", 
-    //                                      G4AnalysisManager::Instance()->GetH1Id(layerPrefix + "FiberNA"));
-    // layer->RegisterPrimitive(primitive);
+    auto fiber = dynamic_cast<G4MultiFunctionalDetector *>(findDetector(fiber_name));
+    if (!fiber)
+    {
+      fiber = new G4MultiFunctionalDetector(fiber_name);
+      sdManager->AddNewDetector(fiber);
 
-    // 注册光子探测器 - 进入光纤的光子
-    primitive = new FiberEntryPhotonScorer("FiberEntryPhotons", 
-                                          G4AnalysisManager::Instance()->GetH1Id(layerPrefix + "FiberEntry"));
-    fiber->RegisterPrimitive(primitive);
-    SetSensitiveDetector(fiber_name, fiber);
+      // 注册光子探测器 - 进入光纤的光子
+      primitive = new FiberEntryPhotonScorer("FiberEntryPhotons", 
+                                            G4AnalysisManager::Instance()->GetH1Id(layerPrefix + "FiberEntry"));
+      fiber->RegisterPrimitive(primitive);
+    }
 
+    auto dispatch = dispatchers.find(id);
+    if (dispatch != dispatchers.end())
+    {
+      dispatch->second.first->AddLayer(id, layer);
+      dispatch->second.second->AddLayer(id, fiber);
+    }
+    else
+    {
+      SetSensitiveDetector(layer_name, layer);
+      SetSensitiveDetector(fiber_name, fiber);
+    }
   }
+
+  timer.Stop();
+  StartupBenchmark::RecordPhase("SD construction", timer.GetRealElapsed());
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -239,6 +410,30 @@ G4bool CompScintSimDetectorConstruction::IsDumpGdml() const { return fDumpGdml;
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void CompScintSimDetectorConstruction::SetVerbose(G4bool val) { fVerbose = val; }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimDetectorConstruction::SetBooleanFreeLayers(G4bool val) { fBooleanFreeLayers = val; }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4bool CompScintSimDetectorConstruction::IsBooleanFreeLayers() const { return fBooleanFreeLayers; }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimDetectorConstruction::SetSurfaceCoatingThreshold(G4double val) { fSurfaceCoatingThreshold = val; }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4double CompScintSimDetectorConstruction::GetSurfaceCoatingThreshold() const { return fSurfaceCoatingThreshold; }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimDetectorConstruction::SetReplicateLayers(G4bool val) { fReplicateLayers = val; }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4bool CompScintSimDetectorConstruction::IsReplicateLayers() const { return fReplicateLayers; }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimDetectorConstruction::SetOverlapCheck(const G4String& mode) { fOverlapCheck = mode; }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4String CompScintSimDetectorConstruction::GetOverlapCheck() const { return fOverlapCheck; }
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 G4bool CompScintSimDetectorConstruction::IsVerbose() const { return fVerbose; }
 
@@ -301,7 +496,7 @@ MyPhysicalVolume *CompScintSimDetectorConstruction::BuildScintillatorLayer(
     G4ThreeVector position)
 {
   // 检查参数
-  G4bool checkOverlaps = true;
+  G4bool checkOverlaps = false; // 见Construct()
 
   // 参数校验
   if (fiber_core_diameter_um >= fiber_cladding_diameter_um)
@@ -337,18 +532,32 @@ MyPhysicalVolume *CompScintSimDetectorConstruction::BuildScintillatorLayer(
   G4Material *scintMaterial = MaterialManager::GetScintillator(
       scint_material_name, scint_lightyield, 1000, -1);
 
-  // 创建coating材料
-  G4Material *coatingMaterial = MaterialManager::GetMaterial(coating_material_name);
-
   // 创建光纤材料
-  G4Material *s_fiberCoreMaterial = MyMaterials::Quartz();
-  G4Material *s_fiberCladdingMaterial = MyMaterials::PVC();
+  G4Material *s_fiberCoreMaterial = MaterialManager::GetMaterial("Quartz");
+  G4Material *s_fiberCladdingMaterial = MaterialManager::GetMaterial("PVC");
 
   // 计算总尺寸（包括coating）
   G4double total_length = scint_length + 2 * coating_thickness;
   G4double total_width = scint_width + 2 * coating_thickness;
   G4double total_height = scint_height + 2 * coating_thickness;
 
+  // 无布尔模式：layer和coating都是完整的长方体，开孔改为coating内的光纤端口子体积，
+  // 光学光子在coating中每次反射都只需对基本体求交。端口必须落在读出面内，否则退回布尔模式
+  G4double readout_face_extent = (readout_face == 1 || readout_face == 3)
+                                     ? std::min(total_length, total_height)
+                                     : std::min(total_width, total_height);
+  G4bool booleanFree = fBooleanFreeLayers;
+  if (booleanFree && hole_diameter > readout_face_extent)
+  {
+    G4cout << "WARNING: Fiber hole of layer " << copynumber << " does not fit in the readout face, "
+           << "using boolean solids for this layer." << G4endl;
+    booleanFree = false;
+  }
+
+  // 薄coating只用光学表面表示：闪烁体直接放在layer中，layer尺寸不变（层的堆叠位置不变），
+  // 闪烁体与layer之间的边界使用coating的光学表面。coating对带电粒子的影响忽略不计
+  G4bool surfaceCoating = coating_thickness < fSurfaceCoatingThreshold;
+
   // 创建layer box
   G4String layerName = "Layer_" + std::to_string(copynumber);
   G4Box *s_layer = new G4Box(layerName, 0.5 * total_length, 0.5 * total_width, 0.5 * total_height);
@@ -390,28 +599,18 @@ MyPhysicalVolume *CompScintSimDetectorConstruction::BuildScintillatorLayer(
   }
 
   // 从layer中切掉hole
-  G4SubtractionSolid *s_layer_with_hole = new G4SubtractionSolid(
-      layerName + "_with_hole", s_layer, s_hole, hole_rot, hole_pos);
+  G4VSolid *s_layer_solid = s_layer;
+  if (!booleanFree)
+  {
+    s_layer_solid = new G4SubtractionSolid(layerName + "_with_hole", s_layer, s_hole, hole_rot, hole_pos);
+  }
   G4LogicalVolume *l_layer = new G4LogicalVolume(
-      s_layer_with_hole, g_world_material, layerName + "_logic");
+      s_layer_solid, g_world_material, layerName + "_logic");
   // 创建layer物理体
   G4String phys_name = "Layer_" + std::to_string(copynumber) + "_phys";
   MyPhysicalVolume *p_layer = new MyPhysicalVolume(
       nullptr, position, phys_name, l_layer, mother_phys, false, copynumber, checkOverlaps);
 
-  // 从coating中切掉hole
-  G4SubtractionSolid *s_coating_with_hole = new G4SubtractionSolid(
-      coatingName + "_with_hole", s_coating, s_hole, hole_rot, hole_pos);
-
-  // 创建coating逻辑体
-  G4LogicalVolume *l_coating = new G4LogicalVolume(
-      s_coating_with_hole, coatingMaterial, coatingName + "_logic");
-
-  // 设置coating的可视化属性（灰色，50%透明度）
-  G4VisAttributes *coating_vis = new G4VisAttributes(G4Colour(0.5, 0.5, 0.5, 0.5));
-  coating_vis->SetForceSolid(true);
-  l_coating->SetVisAttributes(coating_vis);
-
   // 创建闪烁体
   G4String scintName = "scint_layer_" + std::to_string(copynumber);
   G4Box *s_scint = new G4Box(scintName, 0.5 * scint_length, 0.5 * scint_width, 0.5 * scint_height);
@@ -423,17 +622,58 @@ MyPhysicalVolume *CompScintSimDetectorConstruction::BuildScintillatorLayer(
   scint_vis->SetForceSolid(true);
   l_scint->SetVisAttributes(scint_vis);
 
-  // 将coating放入layer
-  MyPhysicalVolume *p_coating = new MyPhysicalVolume(0, G4ThreeVector(0, 0, 0), coatingName, l_coating,
-                                                     p_layer, false, 0, checkOverlaps);
+  // 闪烁体的母体：coating，或薄coating只用表面表示时的layer
+  MyPhysicalVolume *p_scint_mother = p_layer;
+  G4LogicalVolume *l_scint_mother = l_layer;
+  G4LogicalVolume *l_coating = nullptr;
+  if (!surfaceCoating)
+  {
+    // 创建coating材料
+    G4Material *coatingMaterial = MaterialManager::GetMaterial(coating_material_name);
+
+    // 从coating中切掉hole
+    G4VSolid *s_coating_solid = s_coating;
+    if (!booleanFree)
+    {
+      s_coating_solid = new G4SubtractionSolid(coatingName + "_with_hole", s_coating, s_hole, hole_rot, hole_pos);
+    }
+
+    // 创建coating逻辑体
+    l_coating = new G4LogicalVolume(
+        s_coating_solid, coatingMaterial, coatingName + "_logic");
+
+    // 设置coating的可视化属性（灰色，50%透明度）
+    G4VisAttributes *coating_vis = new G4VisAttributes(G4Colour(0.5, 0.5, 0.5, 0.5));
+    coating_vis->SetForceSolid(true);
+    l_coating->SetVisAttributes(coating_vis);
 
-  fVolumeMap[coatingName] = p_coating;
+    // 将coating放入layer
+    MyPhysicalVolume *p_coating = new MyPhysicalVolume(0, G4ThreeVector(0, 0, 0), coatingName, l_coating,
+                                                       p_layer, false, 0, checkOverlaps);
 
-  // 将闪烁体放入coating中央
+    fVolumeMap[coatingName] = p_coating;
+    p_scint_mother = p_coating;
+    l_scint_mother = l_coating;
+  }
+
+  // 将闪烁体放入coating（或layer）中央
   MyPhysicalVolume *p_scint = new MyPhysicalVolume(0, G4ThreeVector(0, 0, 0), scintName, l_scint,
-                                                   p_coating, false, 0, checkOverlaps);
+                                                   p_scint_mother, false, 0, checkOverlaps);
 
   fVolumeMap[scintName] = p_scint;
+
+  // 光纤端口：占据读出面上coating厚度内的开孔区域，材料与布尔模式下的开孔相同（世界材料），
+  // 端口与coating的边界同样使用coating的光学表面；coating只用表面表示时，端口使闪烁体在开孔处不反射
+  if (booleanFree)
+  {
+    G4String portName = "fiber_port_" + std::to_string(copynumber);
+    G4Tubs *s_port = new G4Tubs(portName, 0, 0.5 * hole_diameter, 0.5 * coating_thickness, 0, 360 * deg);
+    G4LogicalVolume *l_port = new G4LogicalVolume(s_port, g_world_material, portName);
+    l_port->SetVisAttributes(G4VisAttributes::GetInvisible());
+    G4ThreeVector port_pos = hole_pos - 0.5 * coating_thickness * hole_pos.unit();
+    new G4PVPlacement(hole_rot, port_pos, l_port, portName, l_scint_mother, false, copynumber, checkOverlaps);
+  }
+
   // 创建光纤cladding
   G4String fiber_cladding_name = "fiber_cladding_" + std::to_string(copynumber);
   G4double fiber_length = g_lg_length; // 光纤长度，可以根据需要调整
@@ -465,7 +705,13 @@ MyPhysicalVolume *CompScintSimDetectorConstruction::BuildScintillatorLayer(
 
   // 计算光纤位置
   G4ThreeVector fiber_pos = hole_pos;
+  // 布尔模式下光纤端面伸入开孔一半的coating厚度；无布尔模式下layer是完整的长方体，
+  // 光纤端面与coating外表面齐平，避免与layer重叠
   G4double fiber_offset = 0.5 * fiber_length - 0.5 * coating_thickness;
+  if (booleanFree)
+  {
+    fiber_offset = 0.5 * fiber_length;
+  }
 
   // 根据readout_face调整光纤位置
   switch (readout_face)
@@ -496,15 +742,178 @@ MyPhysicalVolume *CompScintSimDetectorConstruction::BuildScintillatorLayer(
   }
 
   // 将光纤放入coating
-  new MyPhysicalVolume(fiber_rot, fiber_pos + position, fiber_cladding_name, l_fiber_cladding,
-                       mother_phys, false, copynumber, checkOverlaps);
+  fVolumeMap[fiber_cladding_name] = new MyPhysicalVolume(
+      fiber_rot, fiber_pos + position, fiber_cladding_name, l_fiber_cladding,
+      mother_phys, false, copynumber, checkOverlaps);
 
   // 创建反射层的光学表面
-  new G4LogicalSkinSurface("TeflonSurface", l_coating, g_surf_Teflon);
+  if (surfaceCoating)
+  {
+    // 涂层表面是painted类型，光子在coating体积模型中也不会进入coating，两个方向的边界表面与之等价；
+    // 开孔处闪烁体与开孔（世界或端口）相邻，没有表面
+    G4String surfaceName = "TeflonSurface_" + std::to_string(copynumber);
+    new G4LogicalBorderSurface(surfaceName + "_in", p_scint, p_layer, g_surf_Teflon);
+    new G4LogicalBorderSurface(surfaceName + "_out", p_layer, p_scint, g_surf_Teflon);
+  }
+  else
+  {
+    new G4LogicalSkinSurface("TeflonSurface", l_coating, g_surf_Teflon);
+  }
 
   return p_layer;
 }
 
+/**
+ * @brief 为层的闪烁体建立区域，使各层可以使用不同的产生阈值
+ *
+ * 区域按名字复用，重新加载几何时只更新根逻辑体和阈值，区域自己的阈值对象也复用。
+ * CSV未给出阈值时区域共用世界区域的默认阈值对象，/run/setCut等命令对其同样生效。
+ *
+ * @param copynumber 层的copynumber
+ * @param production_cut 产生阈值，<=0表示使用默认值
+ */
+void CompScintSimDetectorConstruction::SetLayerRegion(G4int copynumber, G4double production_cut)
+{
+  auto it = fVolumeMap.find("scint_layer_" + std::to_string(copynumber));
+  if (it == fVolumeMap.end()) return;
+  G4LogicalVolume *l_scint = it->second->GetLogicalVolume();
+
+  G4String regionName = "scint_layer_" + std::to_string(copynumber) + "_region";
+  G4Region *region = G4RegionStore::GetInstance()->GetRegion(regionName, false);
+  if (!region) region = new G4Region(regionName);
+  l_scint->SetRegion(region);
+  region->AddRootLogicalVolume(l_scint);
+
+  if (production_cut > 0)
+  {
+    // 重新加载几何时复用区域自己的阈值对象，只在区域仍使用默认阈值时新建
+    G4ProductionCuts *defaultCuts = G4ProductionCutsTable::GetProductionCutsTable()->GetDefaultProductionCuts();
+    G4ProductionCuts *cuts = region->GetProductionCuts();
+    if (!cuts || cuts == defaultCuts)
+    {
+      cuts = new G4ProductionCuts();
+      region->SetProductionCuts(cuts);
+    }
+    cuts->SetProductionCut(production_cut);
+    myPrint(INFO, f("Region %s: production cut %.3g mm", regionName.c_str(), production_cut / mm));
+  }
+  else
+  {
+    region->SetProductionCuts(G4ProductionCutsTable::GetProductionCutsTable()->GetDefaultProductionCuts());
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/**
+ * @brief 复制放置一组相同定义的连续层
+ *
+ * 层片（layer、coating、闪烁体、光纤端口和光纤）只构建一次，用G4PVReplica沿z放置，
+ * 各层共用逻辑体、材料和光学表面，层片内的放置只做一次重叠检查。
+ * 层的copynumber由复制编号经ScintillatorLayerManager::GetLayerCopynumber得到。
+ * 层片内的MyPhysicalVolume给出第一层的绝对坐标；其余各层没有物理体，其绝对坐标
+ * 记在fReplicaFrames中，由GetVolumeFrame给出（供源和相空间平面使用）。
+ *
+ * @param run 按堆叠顺序（z从小到大）排列的copynumber
+ * @param mother_phys 母体物理体
+ * @param z_bottom 第一层的下表面
+ * @return false 光纤超出层片，不能复制放置
+ */
+G4bool CompScintSimDetectorConstruction::BuildReplicatedLayers(
+    const std::vector<G4int> &run,
+    MyPhysicalVolume *mother_phys,
+    G4double z_bottom)
+{
+  G4bool checkOverlaps = false; // 见Construct()
+
+  ScintillatorLayerManager &layerManager = ScintillatorLayerManager::GetInstance();
+  const ScintillatorLayerInfo *layerInfo = layerManager.GetLayerInfo(run.front());
+  G4int first = run.front();
+  G4int nReplicas = run.size();
+
+  G4double coating_thickness = layerInfo->GetCoatingThicknessNM();
+  G4double total_length = layerInfo->GetScintLengthMM() + 2 * coating_thickness;
+  G4double total_width = layerInfo->GetScintWidthMM() + 2 * coating_thickness;
+  G4double layer_height = layerInfo->GetScintHeightMM() + 2 * coating_thickness;
+  G4double pitch = layer_height + g_scint_layer_gap;
+
+  // 光纤在层的中心高度，须在层片的z范围内
+  if (layerInfo->GetFiberCladdingDiameterUM() > layer_height)
+  {
+    myPrint(DEBUG, fmt("Fiber of layer {} is thicker than the layer, not replicated", first));
+    return false;
+  }
+
+  G4cout << "Creating layers " << first << " - " << run.back() << " (" << nReplicas
+         << " replicas) scintillator detector..." << G4endl;
+
+  // 层片的横向范围包含伸出读出面的光纤
+  G4double half_x = 0.5 * total_length;
+  G4double half_y = 0.5 * total_width;
+  if (layerInfo->readout_face == 0 || layerInfo->readout_face == 2)
+    half_x += g_lg_length;
+  else
+    half_y += g_lg_length;
+
+  G4String stackName = "LayerStack_" + std::to_string(first);
+  G4Box *s_stack = new G4Box(stackName, half_x, half_y, 0.5 * nReplicas * pitch);
+  G4LogicalVolume *l_stack = new G4LogicalVolume(s_stack, g_world_material, stackName);
+  l_stack->SetVisAttributes(G4VisAttributes::GetInvisible());
+  G4ThreeVector stack_pos(0, 0, z_bottom + 0.5 * nReplicas * pitch);
+  new MyPhysicalVolume(nullptr, stack_pos, stackName, l_stack, mother_phys, false, first, checkOverlaps);
+
+  G4String sliceName = "LayerSlice_" + std::to_string(first);
+  G4Box *s_slice = new G4Box(sliceName, half_x, half_y, 0.5 * pitch);
+  G4LogicalVolume *l_slice = new G4LogicalVolume(s_slice, g_world_material, sliceName);
+  l_slice->SetVisAttributes(G4VisAttributes::GetInvisible());
+  G4VPhysicalVolume *p_slices = new G4PVReplica(sliceName, l_slice, l_stack, kZAxis, nReplicas, pitch);
+  layerManager.RegisterLayerVolume(p_slices, run);
+
+  // 第一片的坐标系：只在构建片内体积时作为母体，为其提供绝对坐标和母逻辑体。
+  // 片内的放置只记录母逻辑体，构建完即删除，不留在G4PhysicalVolumeStore中
+  G4ThreeVector first_slice_pos = stack_pos - G4ThreeVector(0, 0, 0.5 * (nReplicas - 1) * pitch);
+  std::unique_ptr<MyPhysicalVolume> p_frame(new MyPhysicalVolume(
+      nullptr, first_slice_pos, sliceName + "_frame", l_slice, nullptr, false, 0, false));
+
+  // 层在层片底部，与单独放置时的位置相同
+  MyPhysicalVolume *p_layer = BuildScintillatorLayer(
+      first,
+      layerInfo->readout_face,
+      layerInfo->scint_material,
+      layerInfo->scint_lightyield,
+      layerInfo->GetScintLengthMM(),
+      layerInfo->GetScintWidthMM(),
+      layerInfo->GetScintHeightMM(),
+      coating_thickness,
+      layerInfo->coating_material,
+      layerInfo->GetFiberCoreDiameterUM(),
+      layerInfo->GetFiberCladdingDiameterUM(),
+      p_frame.get(),
+      G4ThreeVector(0, 0, 0.5 * (layer_height - pitch)));
+  p_frame.reset();
+  fVolumeMap["Layer_" + std::to_string(first) + "_phys"] = p_layer;
+  // 各层共用同一逻辑体，区域也只有一个
+  SetLayerRegion(first, layerInfo->GetProductionCutMM());
+
+  // 其余各层：第一层的坐标沿z平移k个间距
+  const std::vector<std::pair<G4String, G4String>> names = {
+      {"Layer_", "_phys"}, {"Coating_", ""}, {"scint_layer_", ""}, {"fiber_cladding_", ""}};
+  for (G4int k = 1; k < nReplicas; k++)
+  {
+    for (const auto &name : names)
+    {
+      auto it = fVolumeMap.find(name.first + std::to_string(first) + name.second);
+      if (it == fVolumeMap.end()) continue;
+      VolumeFrame frame = GetVolumeFrame(it->first);
+      frame.position += G4ThreeVector(0, 0, k * pitch);
+      fReplicaFrames[name.first + std::to_string(run[k]) + name.second] = frame;
+    }
+  }
+
+  fReplicatedLayerRuns.push_back(run);
+  return true;
+}
+
 // 根据输入数量和间隔生成坐标
 std::vector<G4ThreeVector> generateCoordinates(int nums, double gaps)
 {
@@ -27,9 +27,16 @@
 #include "CompScintSimDetectorMessenger.hh"
 #include "CompScintSimDetectorConstruction.hh"
 #include "CompScintSimGDMLDetectorConstruction.hh"
+#include "GeometryValidator.hh"
+#include "MaterialDatabase.hh"
+#include "OpticalTableResampler.hh"
+#include "config.hh"
+
 #include "G4UIdirectory.hh"
 #include "G4UIcmdWithABool.hh"
 #include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -41,6 +48,26 @@ CompScintSimDetectorMessenger::CompScintSimDetectorMessenger(
   fDetConDir = new G4UIdirectory("/CompScintSim/DetectorConstruction/");
   fDetConDir->SetGuidance("Configuring Detector Construction");
 
+  fGeometryDir = new G4UIdirectory("/CompScintSim/geometry/");
+  fGeometryDir->SetGuidance("Changing the geometry between runs");
+
+  fReloadGeometryCmd = new G4UIcmdWithAString("/CompScintSim/geometry/reload", this);
+  fReloadGeometryCmd->SetGuidance("Rebuild the world and sensitive detectors from a scintillator geometry CSV");
+  fReloadGeometryCmd->SetGuidance("Physics tables are kept; without argument the current CSV is reloaded.");
+  fReloadGeometryCmd->SetParameterName("fileName", true);
+  fReloadGeometryCmd->SetDefaultValue("");
+  fReloadGeometryCmd->AvailableForStates(G4State_Idle);
+  fReloadGeometryCmd->SetToBeBroadcasted(false); // 几何在主线程重建，工作线程由运行管理器通知
+
+  fLightGuideLengthCmd = new G4UIcmdWithADoubleAndUnit("/CompScintSim/geometry/lightGuideLength", this);
+  fLightGuideLengthCmd->SetGuidance("Set the length of the fibers outside the layers");
+  fLightGuideLengthCmd->SetGuidance("In Idle state it takes effect at the next /CompScintSim/geometry/reload.");
+  fLightGuideLengthCmd->SetParameterName("length", false);
+  fLightGuideLengthCmd->SetRange("length>0.");
+  fLightGuideLengthCmd->SetDefaultUnit("mm");
+  fLightGuideLengthCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  fLightGuideLengthCmd->SetToBeBroadcasted(false);
+
   fVerboseCmd =
     new G4UIcmdWithABool("/CompScintSim/DetectorConstruction/enableVerbose", this);
   fVerboseCmd->SetGuidance("Set flag for enabling verbose diagnostic printout");
@@ -54,11 +81,60 @@ CompScintSimDetectorMessenger::CompScintSimDetectorMessenger(
   fDumpGdmlCmd->SetDefaultValue(false);
   fDumpGdmlCmd->AvailableForStates(G4State_PreInit);
 
+  fBooleanFreeLayersCmd =
+    new G4UIcmdWithABool("/CompScintSim/DetectorConstruction/booleanFreeLayers", this);
+  fBooleanFreeLayersCmd->SetGuidance("Build layers from primitive solids only");
+  fBooleanFreeLayersCmd->SetGuidance("The fiber hole becomes a fiber-port daughter of the coating instead of a G4SubtractionSolid.");
+  fBooleanFreeLayersCmd->SetDefaultValue(true);
+  fBooleanFreeLayersCmd->AvailableForStates(G4State_PreInit);
+
+  fReplicateLayersCmd =
+    new G4UIcmdWithABool("/CompScintSim/DetectorConstruction/replicateLayers", this);
+  fReplicateLayersCmd->SetGuidance("Place runs of identical consecutive layers with G4PVReplica");
+  fReplicateLayersCmd->SetGuidance("The layers share logical volumes, surfaces and sensitive detectors; scoring is per layer as before.");
+  fReplicateLayersCmd->SetDefaultValue(true);
+  fReplicateLayersCmd->AvailableForStates(G4State_PreInit);
+
+  fSurfaceCoatingThresholdCmd = new G4UIcmdWithADoubleAndUnit(
+    "/CompScintSim/DetectorConstruction/surfaceCoatingThreshold", this);
+  fSurfaceCoatingThresholdCmd->SetGuidance("Coatings thinner than this are built as optical surfaces only");
+  fSurfaceCoatingThresholdCmd->SetGuidance("The crystal then sits directly in the layer envelope, 0 disables.");
+  fSurfaceCoatingThresholdCmd->SetParameterName("thickness", false);
+  fSurfaceCoatingThresholdCmd->SetRange("thickness>=0.");
+  fSurfaceCoatingThresholdCmd->SetDefaultUnit("nm");
+  fSurfaceCoatingThresholdCmd->AvailableForStates(G4State_PreInit);
+
   fDumpGdmlFileNameCmd = new G4UIcmdWithAString(
     "/CompScintSim/DetectorConstruction/dumpGdmlFileName", this);
   fDumpGdmlFileNameCmd->SetGuidance("Enter file name to dump gdml file ");
   fDumpGdmlFileNameCmd->SetDefaultValue("CompScintSim_dump.gdml");
   fDumpGdmlFileNameCmd->AvailableForStates(G4State_PreInit);
+
+  fOverlapCheckCmd = new G4UIcmdWithAString(
+    "/CompScintSim/DetectorConstruction/overlapCheck", this);
+  fOverlapCheckCmd->SetGuidance("Set the overlap check mode, run once after geometry construction");
+  fOverlapCheckCmd->SetGuidance("auto: check unless the cached result for this geometry hash passed");
+  fOverlapCheckCmd->SetGuidance("validate: always check and update the cache");
+  fOverlapCheckCmd->SetGuidance("require: abort unless the cached result for this geometry hash passed");
+  fOverlapCheckCmd->SetGuidance("off: no check");
+  fOverlapCheckCmd->SetParameterName("mode", false);
+  fOverlapCheckCmd->SetCandidates(GeometryValidator::GetModeCandidates());
+  fOverlapCheckCmd->AvailableForStates(G4State_PreInit);
+
+  fMaterialDatabaseCmd = new G4UIcmdWithAString(
+    "/CompScintSim/DetectorConstruction/materialDatabase", this);
+  fMaterialDatabaseCmd->SetGuidance("Set the material database (text source or compiled .matdb)");
+  fMaterialDatabaseCmd->SetGuidance("The text source is compiled to <name>.matdb when it is newer than the binary.");
+  fMaterialDatabaseCmd->SetParameterName("fileName", false);
+  fMaterialDatabaseCmd->AvailableForStates(G4State_PreInit);
+
+  fResampleOpticalTablesCmd = new G4UIcmdWithADouble(
+    "/CompScintSim/DetectorConstruction/resampleOpticalTables", this);
+  fResampleOpticalTablesCmd->SetGuidance("Resample RINDEX, ABSLENGTH, RAYLEIGH and emission spectra onto uniform energy grids");
+  fResampleOpticalTablesCmd->SetGuidance("Argument is the max interpolation error relative to the table maximum, 0 disables resampling.");
+  fResampleOpticalTablesCmd->SetParameterName("tolerance", false);
+  fResampleOpticalTablesCmd->SetRange("tolerance>=0");
+  fResampleOpticalTablesCmd->AvailableForStates(G4State_PreInit);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -66,9 +142,18 @@ CompScintSimDetectorMessenger::CompScintSimDetectorMessenger(
 CompScintSimDetectorMessenger::~CompScintSimDetectorMessenger()
 {
   delete fDetConDir;
+  delete fGeometryDir;
+  delete fReloadGeometryCmd;
+  delete fLightGuideLengthCmd;
   delete fVerboseCmd;
   delete fDumpGdmlCmd;
+  delete fBooleanFreeLayersCmd;
+  delete fReplicateLayersCmd;
+  delete fSurfaceCoatingThresholdCmd;
   delete fDumpGdmlFileNameCmd;
+  delete fOverlapCheckCmd;
+  delete fMaterialDatabaseCmd;
+  delete fResampleOpticalTablesCmd;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -76,6 +161,23 @@ CompScintSimDetectorMessenger::~CompScintSimDetectorMessenger()
 void CompScintSimDetectorMessenger::SetNewValue(G4UIcommand* command,
                                             G4String newValue)
 {
+  // 材料数据库和光学表重采样与具体的探测器构建类无关
+  if(command == fMaterialDatabaseCmd)
+  {
+    MaterialDatabase::Instance().SetFileName(newValue);
+    return;
+  }
+  if(command == fResampleOpticalTablesCmd)
+  {
+    OpticalTableResampler::SetTolerance(fResampleOpticalTablesCmd->GetNewDoubleValue(newValue));
+    return;
+  }
+  if(command == fLightGuideLengthCmd)
+  {
+    g_lg_length = fLightGuideLengthCmd->GetNewDoubleValue(newValue);
+    return;
+  }
+
   CompScintSimDetectorConstruction* dc1 =
     dynamic_cast<CompScintSimDetectorConstruction*>(fCompScintSimDetCon);
   if(dc1 != nullptr)
@@ -86,6 +188,16 @@ void CompScintSimDetectorMessenger::SetNewValue(G4UIcommand* command,
       dc1->SetDumpGdml(fDumpGdmlCmd->GetNewBoolValue(newValue));
     if(command == fDumpGdmlFileNameCmd)
       dc1->SetDumpGdmlFile(newValue);
+    if(command == fOverlapCheckCmd)
+      dc1->SetOverlapCheck(newValue);
+    if(command == fBooleanFreeLayersCmd)
+      dc1->SetBooleanFreeLayers(fBooleanFreeLayersCmd->GetNewBoolValue(newValue));
+    if(command == fReplicateLayersCmd)
+      dc1->SetReplicateLayers(fReplicateLayersCmd->GetNewBoolValue(newValue));
+    if(command == fSurfaceCoatingThresholdCmd)
+      dc1->SetSurfaceCoatingThreshold(fSurfaceCoatingThresholdCmd->GetNewDoubleValue(newValue));
+    if(command == fReloadGeometryCmd)
+      dc1->ReloadGeometry(newValue.empty() ? g_ScintillatorGeometry : newValue);
   }
   else
   {
@@ -34,12 +34,20 @@
 #include "CompScintSimRun.hh"
 #include "CompScintSimRunAction.hh"
 #include "G4Event.hh"
+#include "G4EventManager.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4PrimaryParticle.hh"
+#include "G4PrimaryVertex.hh"
 #include "G4RunManager.hh"
 #include "G4Threading.hh"
 #include "G4SystemOfUnits.hh"
 #include "config.hh"
 #include "utilities.hh"
 #include "ScintillatorLayerManager.hh"
+#include "StartupBenchmark.hh"
+#include "EventWatchdog.hh"
+#include "MyEventInfo.hh"
+#include "OpticalPhotonScheduler.hh"
 #include <fstream>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -47,18 +55,17 @@ CompScintSimEventAction::CompScintSimEventAction(CompScintSimRunAction* runActio
     : G4UserEventAction(), fRunAction(runAction)
 {
   // 初始化能量沉积数组
-  // 获取层信息
-  ScintillatorLayerManager& layerManager = ScintillatorLayerManager::GetInstance();
-  if (!layerManager.IsInitialized()) {
-    layerManager.Initialize(g_ScintillatorGeometry);
-  }
-  
-  // 初始化能量沉积容器大小
-  std::vector<G4int> copynumbers = layerManager.GetCopynumbers();
-  fLayerCopynumbers = copynumbers;
+  UpdateLayers();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimEventAction::UpdateLayers()
+{
+  // 获取层信息（只读快照）
+  fLayers = &ScintillatorLayerManager::GetInstance().GetSnapshot();
   
   // 初始化数组大小为层数
-  fEnergyDeposit.resize(copynumbers.size(), 0.0);
+  fEnergyDeposit.assign(fLayers->Size(), 0.0);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -67,8 +74,17 @@ CompScintSimEventAction::~CompScintSimEventAction() {}
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void CompScintSimEventAction::BeginOfEventAction(const G4Event *)
 {
+  fEventStart = StartupBenchmark::Elapsed();
+  EventWatchdog::BeginEvent();
+
   // 清空处理过的光子ID集合
   processedTrackIDs.clear();
+  if (fRunAction) fRunAction->GetPhaseSpaceRecorder()->BeginOfEvent();
+
+  // 几何在两次运行之间重新载入后更新层列表
+  if (fLayers != &ScintillatorLayerManager::GetInstance().GetSnapshot()) {
+    UpdateLayers();
+  }
   
   // 清零所有通道的能量沉积
   std::fill(fEnergyDeposit.begin(), fEnergyDeposit.end(), 0.0);
@@ -77,6 +93,25 @@ void CompScintSimEventAction::BeginOfEventAction(const G4Event *)
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void CompScintSimEventAction::EndOfEventAction(const G4Event *event)
 {
+  // 为其他线程处理光学光子批的事件，结果已记在批中，由源事件的线程写出
+  if (OpticalPhotonScheduler::IsHelperEvent()) return;
+
+  // 本事件的光学光子批（OpticalPhotonScheduler）按批的顺序加到本事件；批被中止时整个事件按中止处理
+  auto eventInfo = dynamic_cast<MyEventInfo*>(event->GetUserInformation());
+  for (const auto& batch : OpticalPhotonScheduler::TakeResults()) {
+    for (size_t i = 0; i < fEnergyDeposit.size() && i < batch.deposits.size(); i++) {
+      fEnergyDeposit[i] += batch.deposits[i];
+    }
+    if (fRunAction) {
+      fRunAction->CountSteps(batch.steps, batch.opticalSteps);
+      fRunAction->GetPhaseSpaceRecorder()->AddRecords(batch.crossings);
+    }
+    if (!batch.abortReason.empty() && !event->IsAborted()) {
+      G4EventManager::GetEventManager()->GetNonconstCurrentEvent()->SetEventAborted();
+      if (eventInfo) eventInfo->SetAbortReason(batch.abortReason);
+    }
+  }
+
   // 输出事件进度
   if (1) {
     auto eventID = event->GetEventID();
@@ -90,26 +125,56 @@ void CompScintSimEventAction::EndOfEventAction(const G4Event *event)
 
   // 将数据写入线程CSV文件
   if (fRunAction) {
-    // 获取CSV文件名
+    // 事件权重（无偏源为1），加权统计时使用
+    G4double weight = 1.;
+    EventSeeder::Seeds seeds;
+    G4String status = event->IsAborted() ? EventWatchdog::kAbortOther : "ok";
+    if (eventInfo) {
+      weight = eventInfo->GetWeight();
+      seeds = eventInfo->GetSeeds();
+      if (event->IsAborted() && !eventInfo->GetAbortReason().empty()) status = eventInfo->GetAbortReason();
+    }
+
+    // 初级粒子摘要：个数、第一个初级粒子的种类和全部初级粒子的动能之和
+    G4int nPrimaries = 0;
+    G4double primaryEnergy = 0.;
+    G4String primaryName = "none";
+    for (G4int i = 0; i < event->GetNumberOfPrimaryVertex(); i++) {
+      for (auto primary = event->GetPrimaryVertex(i)->GetPrimary(); primary; primary = primary->GetNext()) {
+        if (nPrimaries++ == 0) primaryName = primary->GetG4code()->GetParticleName();
+        primaryEnergy += primary->GetKineticEnergy();
+      }
+    }
+    G4double eventEnd = StartupBenchmark::Elapsed();
+
+    // 追加数据到线程CSV文件；打开失败时只跳过这一行，下面的统计和记录照常进行
     G4String csvFileName = fRunAction->GetThreadCsvFileName();
-    
-    // 追加数据到CSV文件
     std::ofstream outFile(csvFileName, std::ios::app);
-    
     if (!outFile.is_open()) {
       G4cerr << "Error: Could not open file " << csvFileName << " for writing!" << G4endl;
-      return;
     }
-    
-    // 写入一行事件数据
-    for (size_t i = 0; i < fEnergyDeposit.size(); i++) {
-      outFile << fEnergyDeposit[i]/MeV; // 转换为MeV
-      if (i < fEnergyDeposit.size() - 1) {
-        outFile << ",";
+    else {
+      // 写入一行事件数据，前CompScintSimRunAction::kEventIndexColumns列为事件索引（eventID、种子、
+      // 初级粒子摘要、状态和耗时），合并时按eventID排序后分到索引文件，被中止的事件不写入合并后的文件
+      outFile << event->GetEventID() << "," << seeds.engine[0] << "," << seeds.engine[1] << ","
+              << seeds.aux << "," << nPrimaries << "," << primaryName << "," << primaryEnergy / MeV << ","
+              << status << "," << eventEnd - fEventStart << ",";
+      for (size_t i = 0; i < fEnergyDeposit.size(); i++) {
+        outFile << fEnergyDeposit[i]/MeV << ","; // 转换为MeV
       }
+      outFile << weight << "\n";
+      outFile.close();
     }
-    outFile << "\n";
-    outFile.close();
+
+    // 被中止的事件不写入相空间文件和初级粒子转储，从这些文件重新开始时不会模拟不完整的事件
+    fRunAction->GetPhaseSpaceRecorder()->EndOfEvent(event->IsAborted());
+    if (auto primaryWriter = fRunAction->GetPrimaryWriter()) {
+      if (!event->IsAborted()) primaryWriter->WriteEvent(event);
+    }
+
+    // 线程负载统计
+    fRunAction->CountEventTime(fEventStart, eventEnd);
+    if (event->IsAborted()) fRunAction->CountAbortedEvent(status);
   }
 }
 
@@ -117,11 +182,15 @@ void CompScintSimEventAction::EndOfEventAction(const G4Event *event)
 void CompScintSimEventAction::AddEnergyDeposit(G4int copyNumber, G4double edep)
 {
   // 找到对应的索引
-  for (size_t i = 0; i < fLayerCopynumbers.size(); i++) {
-    if (fLayerCopynumbers[i] == copyNumber) {
-      fEnergyDeposit[i] += edep;
-      return;
+  G4int index = fLayers->IndexOf(copyNumber);
+  if (index >= 0) {
+    // 处理光学光子批时沉积记在批中，事件结束时按批的顺序相加
+    if (OpticalPhotonScheduler::BatchResult* batch = OpticalPhotonScheduler::GetCurrentBatch()) {
+      batch->deposits[index] += edep;
+    } else {
+      fEnergyDeposit[index] += edep;
     }
+    return;
   }
   
   // 如果到这里，说明copyNumber不在我们的列表中
@@ -0,0 +1,239 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+/// \file CompScintSim/src/CompScintSimPhysicsList.cc
+/// \brief Implementation of the CompScintSimPhysicsList class
+
+#include "CompScintSimPhysicsList.hh"
+#include "CompScintSimPhysicsListMessenger.hh"
+#include "PhysicsTableCache.hh"
+
+#include "G4DecayPhysics.hh"
+#include "G4EmExtraPhysics.hh"
+#include "G4EmLivermorePhysics.hh"
+#include "G4EmStandardPhysics.hh"
+#include "G4EmStandardPhysics_option3.hh"
+#include "G4EmStandardPhysics_option4.hh"
+#include "G4Exception.hh"
+#include "G4HadronElasticPhysics.hh"
+#include "G4HadronPhysicsFTFP_BERT.hh"
+#include "G4IonPhysics.hh"
+#include "G4NeutronTrackingCut.hh"
+#include "G4OpticalParameters.hh"
+#include "G4OpticalPhysics.hh"
+#include "G4StoppingPhysics.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <algorithm>
+#include <sstream>
+
+#include "config.hh"
+#include "utilities.hh"
+
+namespace
+{
+  // 光学过程的开关名及对应的Geant4过程名
+  const std::vector<std::pair<G4String, std::vector<G4String>>> kOpticalProcesses = {
+    {"scintillation", {"Scintillation"}},
+    {"cerenkov", {"Cerenkov"}},
+    {"absorption", {"OpAbsorption"}},
+    {"rayleigh", {"OpRayleigh"}},
+    {"wls", {"OpWLS", "OpWLS2"}}
+  };
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+CompScintSimPhysicsList::CompScintSimPhysicsList(const G4String& preset)
+    : G4VModularPhysicsList(), fOptical(g_has_opticalPhysics)
+{
+  G4String em = "em4";
+  G4bool hadronic = true;
+
+  // 切伦科夫光默认不产生，其余光学过程默认打开
+  SetOpticalProcess("cerenkov", false);
+  SetTrackSecondariesFirst(true);
+
+  std::stringstream ss(preset);
+  std::string token;
+  while (std::getline(ss, token, ','))
+  {
+    if (token.empty())
+      continue;
+    if (token == "em0" || token == "em3" || token == "em4" || token == "livermore")
+      em = token;
+    else if (token == "hadronic")
+      hadronic = true;
+    else if (token == "nohadronic")
+      hadronic = false;
+    else if (token == "optical")
+      fOptical = true;
+    else if (token == "nooptical")
+      fOptical = false;
+    else if (IsOpticalProcess(token))
+      SetOpticalProcess(token, true);
+    else if (token.rfind("no", 0) == 0 && IsOpticalProcess(token.substr(2)))
+      SetOpticalProcess(token.substr(2), false);
+    else
+    {
+      G4ExceptionDescription ed;
+      ed << "Unknown physics preset item \"" << token << "\" in \"" << preset << "\"." << G4endl
+         << "Valid items: em0 em3 em4 livermore hadronic nohadronic optical nooptical," << G4endl
+         << "[no]scintillation [no]cerenkov [no]absorption [no]rayleigh [no]wls";
+      G4Exception("CompScintSimPhysicsList::CompScintSimPhysicsList", "UnknownPhysicsPreset",
+                  FatalException, ed);
+    }
+  }
+
+  SetDefaultCutValue(0.7 * mm);
+  G4int ver = 1;
+  SetVerboseLevel(ver);
+
+  // 电磁物理
+  if (em == "em0")
+    RegisterPhysics(new G4EmStandardPhysics(ver));
+  else if (em == "em3")
+    RegisterPhysics(new G4EmStandardPhysics_option3(ver));
+  else if (em == "livermore")
+    RegisterPhysics(new G4EmLivermorePhysics(ver));
+  else
+    RegisterPhysics(new G4EmStandardPhysics_option4(ver));
+
+  RegisterPhysics(new G4DecayPhysics(ver));
+
+  // 强子物理，与FTFP_BERT相同
+  if (hadronic)
+  {
+    RegisterPhysics(new G4EmExtraPhysics(ver));
+    RegisterPhysics(new G4HadronElasticPhysics(ver));
+    RegisterPhysics(new G4HadronPhysicsFTFP_BERT(ver));
+    RegisterPhysics(new G4StoppingPhysics(ver));
+    RegisterPhysics(new G4IonPhysics(ver));
+    RegisterPhysics(new G4NeutronTrackingCut(ver));
+  }
+
+  if (fOptical)
+    RegisterPhysics(new G4OpticalPhysics());
+
+  // 其余模块按光学物理开关工作（如StackingAction中的光子处理）
+  g_has_opticalPhysics = fOptical;
+
+  fPresetName = em + (hadronic ? ",hadronic" : ",nohadronic") + (fOptical ? ",optical" : ",nooptical");
+  myPrint(INFO, fmt("Physics preset: {}", fPresetName));
+
+  fMessenger = new CompScintSimPhysicsListMessenger(this);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+CompScintSimPhysicsList::~CompScintSimPhysicsList()
+{
+  delete fMessenger;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void CompScintSimPhysicsList::SetCuts()
+{
+  G4VUserPhysicsList::SetCuts();
+
+  // 此时几何已经构建，材料和各区域的阈值都已确定
+  PhysicsTableCache::Prepare(this, fPresetName + "|" + GetOpticalSummary());
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+const std::vector<G4String>& CompScintSimPhysicsList::GetOpticalProcessNames()
+{
+  static std::vector<G4String> names;
+  if (names.empty())
+  {
+    for (const auto& process : kOpticalProcesses)
+      names.push_back(process.first);
+  }
+  return names;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool CompScintSimPhysicsList::IsOpticalProcess(const G4String& process)
+{
+  const auto& names = GetOpticalProcessNames();
+  return std::find(names.begin(), names.end(), process) != names.end();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void CompScintSimPhysicsList::SetOpticalProcess(const G4String& process, G4bool active)
+{
+  for (const auto& entry : kOpticalProcesses)
+  {
+    if (entry.first != process)
+      continue;
+    for (const auto& name : entry.second)
+      G4OpticalParameters::Instance()->SetProcessActivation(name, active);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void CompScintSimPhysicsList::SetMaxPhotonsPerStep(G4int photons)
+{
+  G4OpticalParameters::Instance()->SetCerenkovMaxPhotonsPerStep(photons);
+}
+
+void CompScintSimPhysicsList::SetMaxBetaChange(G4double percent)
+{
+  G4OpticalParameters::Instance()->SetCerenkovMaxBetaChange(percent);
+}
+
+void CompScintSimPhysicsList::SetTrackSecondariesFirst(G4bool first)
+{
+  G4OpticalParameters::Instance()->SetCerenkovTrackSecondariesFirst(first);
+  G4OpticalParameters::Instance()->SetScintTrackSecondariesFirst(first);
+}
+
+void CompScintSimPhysicsList::SetScintByParticleType(G4bool byParticleType)
+{
+  G4OpticalParameters::Instance()->SetScintByParticleType(byParticleType);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4String CompScintSimPhysicsList::GetOpticalSummary() const
+{
+  if (!fOptical)
+    return "off";
+
+  G4OpticalParameters* params = G4OpticalParameters::Instance();
+  std::stringstream ss;
+  for (const auto& entry : kOpticalProcesses)
+    ss << entry.first << "=" << (params->GetProcessActivation(entry.second[0]) ? "on" : "off") << " ";
+  ss << "maxPhotonsPerStep=" << params->GetCerenkovMaxPhotonsPerStep()
+     << " maxBetaChange=" << params->GetCerenkovMaxBetaChange() << "%"
+     << " trackSecondariesFirst=" << (params->GetScintTrackSecondariesFirst() ? "on" : "off")
+     << " scintByParticleType=" << (params->GetScintByParticleType() ? "on" : "off");
+  return ss.str();
+}
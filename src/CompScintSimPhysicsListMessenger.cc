@@ -0,0 +1,116 @@
+#include "CompScintSimPhysicsListMessenger.hh"
+#include "CompScintSimPhysicsList.hh"
+#include "PhysicsTableCache.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcommand.hh"
+#include "G4StateManager.hh"
+#include "G4UImanager.hh"
+
+// ------------------------------------------------------------------
+//
+/// \file CompScintSimPhysicsListMessenger.cc
+/// \brief Implementation of the CompScintSimPhysicsListMessenger class
+//
+// ------------------------------------------------------------------
+
+//----------------------------------------------------------------------------//
+CompScintSimPhysicsListMessenger::CompScintSimPhysicsListMessenger(CompScintSimPhysicsList* physicsList)
+ : G4UImessenger(),
+   fPhysicsList(physicsList)
+{
+    fPhysicsDir = new G4UIdirectory("/CompScintSim/physics/");
+    fPhysicsDir->SetGuidance("Physics list settings");
+
+    fTableCacheCmd = new G4UIcmdWithAString("/CompScintSim/physics/tableCache", this);
+    fTableCacheCmd->SetGuidance("Store physics tables in this directory and retrieve them on later starts (none to disable)");
+    fTableCacheCmd->SetGuidance("Tables are keyed by physics list, production cuts and materials.");
+    fTableCacheCmd->SetParameterName("directory", false);
+    fTableCacheCmd->AvailableForStates(G4State_PreInit);
+
+    fOpticalDir = new G4UIdirectory("/CompScintSim/optical/");
+    fOpticalDir->SetGuidance("Optical physics settings, process switches apply at construction");
+
+    // 过程开关：/CompScintSim/optical/<过程> true|false
+    for (const G4String& process : CompScintSimPhysicsList::GetOpticalProcessNames()) {
+        auto cmd = new G4UIcmdWithABool(("/CompScintSim/optical/" + process).c_str(), this);
+        cmd->SetGuidance(("Enable or disable the " + process + " process").c_str());
+        cmd->SetParameterName("active", true);
+        cmd->SetDefaultValue(true);
+        cmd->AvailableForStates(G4State_PreInit);
+        fProcessCmds[cmd] = process;
+    }
+
+    fMaxPhotonsPerStepCmd = new G4UIcmdWithAnInteger("/CompScintSim/optical/maxPhotonsPerStep", this);
+    fMaxPhotonsPerStepCmd->SetGuidance("Limit the step so that at most this many Cerenkov photons are generated");
+    fMaxPhotonsPerStepCmd->SetParameterName("photons", false);
+    fMaxPhotonsPerStepCmd->SetRange("photons>0");
+    fMaxPhotonsPerStepCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fMaxBetaChangeCmd = new G4UIcmdWithADouble("/CompScintSim/optical/maxBetaChange", this);
+    fMaxBetaChangeCmd->SetGuidance("Limit the step so that beta changes by at most this percentage (Cerenkov)");
+    fMaxBetaChangeCmd->SetParameterName("percent", false);
+    fMaxBetaChangeCmd->SetRange("percent>0.");
+    fMaxBetaChangeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fTrackSecondariesFirstCmd = new G4UIcmdWithABool("/CompScintSim/optical/trackSecondariesFirst", this);
+    fTrackSecondariesFirstCmd->SetGuidance("Track scintillation and Cerenkov photons before the parent continues");
+    fTrackSecondariesFirstCmd->SetParameterName("first", true);
+    fTrackSecondariesFirstCmd->SetDefaultValue(true);
+    fTrackSecondariesFirstCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fScintByParticleTypeCmd = new G4UIcmdWithABool("/CompScintSim/optical/scintByParticleType", this);
+    fScintByParticleTypeCmd->SetGuidance("Use particle dependent scintillation yields");
+    fScintByParticleTypeCmd->SetGuidance("Scintillators need ELECTRONSCINTILLATIONYIELD etc. in materials.txt.");
+    fScintByParticleTypeCmd->SetParameterName("byParticleType", true);
+    fScintByParticleTypeCmd->SetDefaultValue(true);
+    fScintByParticleTypeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//----------------------------------------------------------------------------//
+CompScintSimPhysicsListMessenger::~CompScintSimPhysicsListMessenger()
+{
+    delete fTableCacheCmd;
+    delete fPhysicsDir;
+    for (auto& cmd : fProcessCmds) delete cmd.first;
+    delete fMaxPhotonsPerStepCmd;
+    delete fMaxBetaChangeCmd;
+    delete fTrackSecondariesFirstCmd;
+    delete fScintByParticleTypeCmd;
+    delete fOpticalDir;
+}
+
+//----------------------------------------------------------------------------//
+void CompScintSimPhysicsListMessenger::SetNewValue(G4UIcommand* cmd, G4String newValue)
+{
+    auto it = fProcessCmds.find(cmd);
+    if (cmd == fTableCacheCmd) {
+        PhysicsTableCache::SetDirectory(newValue);
+    }
+    else if (it != fProcessCmds.end()) {
+        fPhysicsList->SetOpticalProcess(it->second, G4UIcmdWithABool::GetNewBoolValue(newValue));
+    }
+    else if (cmd == fMaxPhotonsPerStepCmd) {
+        fPhysicsList->SetMaxPhotonsPerStep(fMaxPhotonsPerStepCmd->GetNewIntValue(newValue));
+    }
+    else if (cmd == fMaxBetaChangeCmd) {
+        fPhysicsList->SetMaxBetaChange(fMaxBetaChangeCmd->GetNewDoubleValue(newValue));
+    }
+    else if (cmd == fTrackSecondariesFirstCmd) {
+        fPhysicsList->SetTrackSecondariesFirst(fTrackSecondariesFirstCmd->GetNewBoolValue(newValue));
+    }
+    else if (cmd == fScintByParticleTypeCmd) {
+        fPhysicsList->SetScintByParticleType(fScintByParticleTypeCmd->GetNewBoolValue(newValue));
+    }
+
+    // 已建立的光学过程只在准备物理表时读取G4OpticalParameters，初始化后修改参数须重建物理表
+    // （与Geant4的/process/optical/命令相同）
+    if ((cmd == fMaxPhotonsPerStepCmd || cmd == fMaxBetaChangeCmd || cmd == fTrackSecondariesFirstCmd ||
+         cmd == fScintByParticleTypeCmd) &&
+        G4StateManager::GetStateManager()->GetCurrentState() == G4State_Idle) {
+        G4UImanager::GetUIpointer()->ApplyCommand("/run/physicsModified");
+    }
+}
@@ -12,18 +12,27 @@
 #include "G4VPhysicalVolume.hh"
 #include "G4LogicalVolume.hh"
 #include "G4RunManager.hh"
+#include "G4PrimaryVertex.hh"
+#include "G4PhysicalConstants.hh"
 
 #include "Randomize.hh"
 
 #include "utilities.hh"
 #include "MyPhysicalVolume.hh"
+#include "MyEventInfo.hh"
+#include "EventReplay.hh"
+#include "EventSeeder.hh"
+#include "ScintillatorLayerManager.hh"
 #include "config.hh"
+#include <algorithm>
 #include <iomanip>
 #include <mutex>  // 添加互斥锁的头文件
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 CompScintSimPrimaryGeneratorAction::CompScintSimPrimaryGeneratorAction(CompScintSimDetectorConstruction *detectorConstruction)
-    : G4VUserPrimaryGeneratorAction(), fParticleGun(nullptr), useParticleGun(false), fDetectorConstruction(detectorConstruction), fCurrentEventIndex(0), fTotalParticleCount(0)
+    : G4VUserPrimaryGeneratorAction(), fParticleGun(nullptr), useParticleGun(false), fSourceMode(SourceMode::GPS), fDetectorConstruction(detectorConstruction), fCurrentEventIndex(0), fTotalParticleCount(0),
+      fOmniInitialized(false), fOmniMargin(1 * mm), fOmniWeight(1.0), fOmniFluencePerPrimary(0.0),
+      fReplayWrapWarned(false)
 {
   fGunMessenger = new CompScintSimPrimaryGeneratorMessenger(this);
 
@@ -45,9 +54,6 @@ CompScintSimPrimaryGeneratorAction::CompScintSimPrimaryGeneratorAction(CompScint
   fGPS->GetCurrentSource()->GetPosDist()->SetCentreCoords(source_position);
   fGPS->GetCurrentSource()->GetEneDist()->SetMonoEnergy(energy);
   fGPS->GetCurrentSource()->GetAngDist()->SetParticleMomentumDirection(G4ThreeVector(0., 0., 1.));
-
-  // 初始化随机数生成器
-  gen.seed(static_cast<unsigned long>(time(nullptr)));
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -61,8 +67,23 @@ CompScintSimPrimaryGeneratorAction::~CompScintSimPrimaryGeneratorAction()
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void CompScintSimPrimaryGeneratorAction::GeneratePrimaries(G4Event *anEvent)
 {
-  // 初始化投影区域（如果尚未初始化）
   G4RunManager *runManager = G4RunManager::GetRunManager();
+
+  // 事件的所有随机数都由事件种子决定，与处理该事件的线程无关；重放时使用原事件的runID和eventID
+  G4int runID = runManager->GetCurrentRun()->GetRunID();
+  if (EventReplay::IsActive())
+  {
+    runID = EventReplay::GetRunID();
+    anEvent->SetEventID(EventReplay::GetEventID());
+  }
+  EventSeeder::Seeds seeds = EventSeeder::SeedEvent(runID, anEvent->GetEventID());
+  std::seed_seq auxSeed{static_cast<std::uint32_t>(seeds.aux), static_cast<std::uint32_t>(seeds.aux >> 32)};
+  gen.seed(auxSeed);
+  MyEventInfo *eventInfo = new MyEventInfo();
+  eventInfo->SetSeeds(seeds);
+  anEvent->SetUserInformation(eventInfo);
+
+  // 初始化投影区域（如果尚未初始化）
   detector = dynamic_cast<const CompScintSimDetectorConstruction *>(runManager->GetUserDetectorConstruction());
   if (!detector)
   {
@@ -73,6 +94,32 @@ void CompScintSimPrimaryGeneratorAction::GeneratePrimaries(G4Event *anEvent)
 
   InitializeProjectionArea();
 
+  if (fSourceMode == SourceMode::Omni)
+  {
+    GenerateOmniPrimary(anEvent);
+    return;
+  }
+
+  if (fSourceMode == SourceMode::Replay)
+  {
+    GenerateReplayPrimary(anEvent);
+    return;
+  }
+
+  if (fSourceMode == SourceMode::PhaseSpace)
+  {
+    GeneratePhaseSpacePrimary(anEvent);
+    return;
+  }
+
+  if (fSourceMode == SourceMode::OpticalPhoton)
+  {
+    // 材料没有发射谱时使用ParticleGun的能量
+    fOpticalSource.SetFallbackEnergy(fParticleGun->GetParticleEnergy());
+    fOpticalSource.GeneratePrimaries(anEvent, detector);
+    return;
+  }
+
   // 根据选择使用ParticleGun或自定义GPS源
   if (useParticleGun)
   {
@@ -82,9 +129,9 @@ void CompScintSimPrimaryGeneratorAction::GeneratePrimaries(G4Event *anEvent)
     G4double y = disY(gen);
 
 
-    MyPhysicalVolume *p_shield = detector->GetMyVolume("scint_layer_1");
-    G4Box *shield_box = dynamic_cast<G4Box *>(p_shield->GetLogicalVolume()->GetSolid());
-    z_pos = p_shield->GetAbsolutePosition().z() + shield_box->GetZHalfLength() + 5 * mm;
+    VolumeFrame shield = detector->GetVolumeFrame("scint_layer_1");
+    G4Box *shield_box = dynamic_cast<G4Box *>(shield.logical->GetSolid());
+    z_pos = shield.position.z() + shield_box->GetZHalfLength() + 5 * mm;
 
     G4ThreeVector sourcePosition(x, y, z_pos);
     G4ThreeVector direction(0, 0, -1);
@@ -107,9 +154,9 @@ void CompScintSimPrimaryGeneratorAction::GeneratePrimaries(G4Event *anEvent)
       G4double x = disX(gen);
       G4double y = disY(gen);
 
-      MyPhysicalVolume *p_shield = detector->GetMyVolume("scint_layer_1");
-      G4Box *shield_box = dynamic_cast<G4Box *>(p_shield->GetLogicalVolume()->GetSolid());
-      z_pos = p_shield->GetAbsolutePosition().z() + shield_box->GetZHalfLength() + 5 * mm;
+      VolumeFrame shield = detector->GetVolumeFrame("scint_layer_1");
+      G4Box *shield_box = dynamic_cast<G4Box *>(shield.logical->GetSolid());
+      z_pos = shield.position.z() + shield_box->GetZHalfLength() + 5 * mm;
 
       G4ThreeVector sourcePosition(x, y, z_pos);
       G4ThreeVector direction(0, 0, -1);
@@ -155,9 +202,9 @@ void CompScintSimPrimaryGeneratorAction::GeneratePrimaries(G4Event *anEvent)
       myPrint(DEBUG, fmt("Processing source {}: {} particles, energy {} MeV, {} particles",
                          source.id, source.particleType, source.energy / MeV, source.count));
 
-      MyPhysicalVolume *p_shield = detector->GetMyVolume("scint_layer_1");
-      G4Box *shield_box = dynamic_cast<G4Box *>(p_shield->GetLogicalVolume()->GetSolid());
-      z_pos = p_shield->GetAbsolutePosition().z() + shield_box->GetZHalfLength() + 5 * mm;
+      VolumeFrame shield = detector->GetVolumeFrame("scint_layer_1");
+      G4Box *shield_box = dynamic_cast<G4Box *>(shield.logical->GetSolid());
+      z_pos = shield.position.z() + shield_box->GetZHalfLength() + 5 * mm;
       G4ThreeVector direction(0, 0, -1);
       fGPS->GetCurrentSource()->GetPosDist()->SetPosDisType("Point");
       fGPS->GetCurrentSource()->GetAngDist()->SetParticleMomentumDirection(direction);
@@ -256,7 +303,196 @@ void CompScintSimPrimaryGeneratorAction::ListGPSSources() const
 
 void CompScintSimPrimaryGeneratorAction::SetUseParticleGun(G4bool useGun)
 {
-  useParticleGun = useGun;
+  SetSourceMode(useGun ? SourceMode::ParticleGun : SourceMode::GPS);
+}
+
+void CompScintSimPrimaryGeneratorAction::SetSourceMode(SourceMode mode)
+{
+  fSourceMode = mode;
+  // 除自定义GPS外，其余模式的粒子种类和能量都取自ParticleGun
+  useParticleGun = (mode != SourceMode::GPS);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/**
+ * @brief 从初级粒子文件重放
+ *
+ * 文件以只读方式映射并在所有线程间共享，每个事件只做一次索引查找和若干顶点构造，
+ * 不再运行原有的抽样逻辑。事件数超过文件中的事件数时循环使用并给出一次警告。
+ */
+void CompScintSimPrimaryGeneratorAction::GenerateReplayPrimary(G4Event *anEvent)
+{
+  if (!fReplayReader)
+  {
+    if (fReplayFileName.empty())
+    {
+      G4Exception("CompScintSimPrimaryGeneratorAction::GenerateReplayPrimary()", "CompScintSim_002",
+                  FatalException, "Replay source selected but no file set, use /CompScintSim/generator/replayFile");
+    }
+    fReplayReader = PrimaryFileReader::Open(fReplayFileName);
+  }
+
+  G4int nEvents = fReplayReader->GetNumberOfEvents();
+  G4int eventID = anEvent->GetEventID();
+  if (eventID >= nEvents && !fReplayWrapWarned)
+  {
+    G4ExceptionDescription msg;
+    msg << "Replay file " << fReplayFileName << " contains only " << nEvents
+        << " events, primaries will be reused.";
+    G4Exception("CompScintSimPrimaryGeneratorAction::GenerateReplayPrimary()", "CompScintSim_003",
+                JustWarning, msg);
+    fReplayWrapWarned = true;
+  }
+
+  G4int nRecords = 0;
+  const PrimaryRecord *records = fReplayReader->GetEventRecords(eventID % nEvents, nRecords);
+  PrimaryFileReader::AddToEvent(anEvent, records, nRecords);
+
+  myPrint(DEBUG, fmt("Replay source generated {} primaries for event {} from file event {}",
+                     nRecords, eventID, records[0].eventID));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/**
+ * @brief 从相空间文件重新开始
+ *
+ * 事件k对应原始运行的第 k % nSourceEvents 个事件，没有粒子穿过平面的事件为空事件，
+ * 因此运行 nSourceEvents 个事件即与原始运行的统计量一一对应，无需重新归一化。
+ */
+void CompScintSimPrimaryGeneratorAction::GeneratePhaseSpacePrimary(G4Event *anEvent)
+{
+  if (!fPhaseSpaceReader)
+  {
+    if (fPhaseSpaceFileName.empty())
+    {
+      G4Exception("CompScintSimPrimaryGeneratorAction::GeneratePhaseSpacePrimary()", "CompScintSim_002",
+                  FatalException, "Phase-space source selected but no file set, use /CompScintSim/generator/phaseSpaceFile");
+    }
+    fPhaseSpaceReader = PrimaryFileReader::Open(fPhaseSpaceFileName);
+  }
+
+  G4long nSourceEvents = std::max<G4long>(fPhaseSpaceReader->GetNumberOfSourceEvents(), 1);
+  G4int sourceEventID = static_cast<G4int>(anEvent->GetEventID() % nSourceEvents);
+
+  G4int nRecords = 0;
+  const PrimaryRecord *records = fPhaseSpaceReader->FindEvent(sourceEventID, nRecords);
+  if (records)
+  {
+    PrimaryFileReader::AddToEvent(anEvent, records, nRecords);
+  }
+
+  myPrint(DEBUG, fmt("Phase-space source generated {} primaries for event {} from source event {}",
+                     nRecords, anEvent->GetEventID(), sourceEventID));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/**
+ * @brief 初始化各向同性源
+ *
+ * 对凸体而言，各向同性注量Φ下穿过表面元dA、方向在dΩ内的粒子数正比于|cosθ|dAdΩ，
+ * 因此在包围盒表面按面积均匀抽样入射点、按余弦律抽样向内的方向，即可精确地
+ * 只产生与包围盒相交的径迹。
+ * 与外接球上的朴素各向同性源相比，命中概率为 S/(4πR^2)，该值作为事件权重，
+ * 加权后的统计量除以事件数即对应朴素源每个初级粒子的期望值；
+ * 每个初级粒子对应的各向同性注量为 4/S。
+ */
+void CompScintSimPrimaryGeneratorAction::InitializeOmniSource()
+{
+  if (fOmniInitialized)
+    return;
+
+  // 由各层的包围盒求整个叠层的包围盒（世界坐标）
+  G4ThreeVector lo(DBL_MAX, DBL_MAX, DBL_MAX);
+  G4ThreeVector hi(-DBL_MAX, -DBL_MAX, -DBL_MAX);
+  for (const auto &id : ScintillatorLayerManager::GetInstance().GetSnapshot().copynumber)
+  {
+    VolumeFrame layer = detector->GetVolumeFrame("Layer_" + std::to_string(id) + "_phys");
+    G4ThreeVector pMin, pMax;
+    layer.logical->GetSolid()->BoundingLimits(pMin, pMax);
+    pMin += layer.position;
+    pMax += layer.position;
+    for (G4int i = 0; i < 3; i++)
+    {
+      lo[i] = std::min(lo[i], pMin[i]);
+      hi[i] = std::max(hi[i], pMax[i]);
+    }
+  }
+  fOmniMin = lo - G4ThreeVector(fOmniMargin, fOmniMargin, fOmniMargin);
+  fOmniMax = hi + G4ThreeVector(fOmniMargin, fOmniMargin, fOmniMargin);
+
+  G4ThreeVector size = fOmniMax - fOmniMin;
+  // 面的顺序：-X, +X, -Y, +Y, -Z, +Z
+  G4double faceArea[6] = {size.y() * size.z(), size.y() * size.z(),
+                          size.x() * size.z(), size.x() * size.z(),
+                          size.x() * size.y(), size.x() * size.y()};
+  G4double surfaceArea = 0;
+  for (G4int i = 0; i < 6; i++)
+  {
+    surfaceArea += faceArea[i];
+    fOmniFaceCDF[i] = surfaceArea;
+  }
+  for (G4int i = 0; i < 6; i++)
+  {
+    fOmniFaceCDF[i] /= surfaceArea;
+  }
+
+  G4double radius = 0.5 * size.mag();
+  fOmniWeight = surfaceArea / (4 * pi * radius * radius);
+  fOmniFluencePerPrimary = 4 / surfaceArea;
+  fOmniInitialized = true;
+
+  G4cout << "Omni source initialized: box (" << fOmniMin / mm << ") - (" << fOmniMax / mm << ") mm"
+         << ", surface " << surfaceArea / cm2 << " cm2"
+         << ", weight " << fOmniWeight
+         << ", fluence per primary " << fOmniFluencePerPrimary * cm2 << " /cm2" << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimPrimaryGeneratorAction::GenerateOmniPrimary(G4Event *anEvent)
+{
+  InitializeOmniSource();
+
+  // 按面积抽样入射面
+  G4double u = G4UniformRand();
+  G4int face = 0;
+  while (face < 5 && u > fOmniFaceCDF[face])
+    face++;
+  G4int axis = face / 2;
+  G4bool positiveSide = (face % 2 == 1);
+
+  // 在该面上均匀抽样入射点
+  G4ThreeVector size = fOmniMax - fOmniMin;
+  G4ThreeVector sourcePosition(fOmniMin.x() + size.x() * G4UniformRand(),
+                               fOmniMin.y() + size.y() * G4UniformRand(),
+                               fOmniMin.z() + size.z() * G4UniformRand());
+  sourcePosition[axis] = positiveSide ? fOmniMax[axis] : fOmniMin[axis];
+
+  // 按余弦律抽样向内的方向
+  G4ThreeVector inward(0, 0, 0);
+  inward[axis] = positiveSide ? -1 : 1;
+  G4double cosTheta = std::sqrt(G4UniformRand());
+  G4double sinTheta = std::sqrt(1 - cosTheta * cosTheta);
+  G4double phi = twopi * G4UniformRand();
+  G4ThreeVector direction(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+  direction.rotateUz(inward);
+
+  fParticleGun->SetParticlePosition(sourcePosition);
+  fParticleGun->SetParticleMomentumDirection(direction);
+  fParticleGun->GeneratePrimaryVertex(anEvent);
+
+  // 顶点权重会传递给所有径迹（包括次级粒子），计分器据此加权
+  anEvent->GetPrimaryVertex(anEvent->GetNumberOfPrimaryVertex() - 1)->SetWeight(fOmniWeight);
+
+  auto eventInfo = static_cast<MyEventInfo *>(anEvent->GetUserInformation());
+  eventInfo->SetWeight(fOmniWeight);
+  eventInfo->SetFluencePerPrimary(fOmniFluencePerPrimary);
+
+  myPrint(DEBUG, fmt("Omni source generated a particle: face={}, pos=({},{},{}), dir=({},{},{})",
+                     face, sourcePosition.x(), sourcePosition.y(), sourcePosition.z(),
+                     direction.x(), direction.y(), direction.z()));
 }
 
 void CompScintSimPrimaryGeneratorAction::InitializeProjectionArea()
@@ -266,10 +502,10 @@ void CompScintSimPrimaryGeneratorAction::InitializeProjectionArea()
     return;
   isInitialized = true;
   // 获取闪烁体的位置和形状
-  MyPhysicalVolume *physicalScintillator = detector->GetMyVolume("scint_layer_1");
-  G4ThreeVector position = physicalScintillator->GetAbsolutePosition();
-  G4VSolid *solid = physicalScintillator->GetLogicalVolume()->GetSolid();
-  G4RotationMatrix *rotation = physicalScintillator->GetAbsoluteRotation();
+  VolumeFrame scintillator = detector->GetVolumeFrame("scint_layer_1");
+  G4ThreeVector position = scintillator.position;
+  G4VSolid *solid = scintillator.logical->GetSolid();
+  const G4RotationMatrix *rotation = &scintillator.rotation;
 
   if (G4Box *box = dynamic_cast<G4Box *>(solid))
   {
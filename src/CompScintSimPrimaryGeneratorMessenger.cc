@@ -37,6 +37,8 @@
 #include "G4UIcmdWithADoubleAndUnit.hh"
 #include "G4UIdirectory.hh"
 #include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
 #include "G4UIcommand.hh"
 #include "G4UIparameter.hh"
 #include "utilities.hh"
@@ -66,6 +68,55 @@ CompScintSimPrimaryGeneratorMessenger::CompScintSimPrimaryGeneratorMessenger(
   fSetUseParticleGunCmd->SetGuidance("Set whether to use ParticleGun or GPS.");
   fSetUseParticleGunCmd->SetParameterName("useParticleGun", true);
   fSetUseParticleGunCmd->SetDefaultValue(true);
+
+  fSourceModeCmd = new G4UIcmdWithAString("/CompScintSim/generator/source", this);
+  fSourceModeCmd->SetGuidance("Select the primary source mode.");
+  fSourceModeCmd->SetGuidance("  gun  : ParticleGun shooting straight down onto scint_layer_1");
+  fSourceModeCmd->SetGuidance("  gps  : custom GPS sources (/gps/my_source/...)");
+  fSourceModeCmd->SetGuidance("  omni : isotropic flux restricted to tracks hitting the detector box, weighted");
+  fSourceModeCmd->SetGuidance("  replay : primaries read from a file written by /MySim/dumpPrimaries");
+  fSourceModeCmd->SetGuidance("  optical : optical photons emitted inside a scintillator layer, in chunks");
+  fSourceModeCmd->SetGuidance("  phasespace : restart from a phase-space plane written by /MySim/phaseSpace");
+  fSourceModeCmd->SetParameterName("mode", false);
+  fSourceModeCmd->SetCandidates("gun gps omni replay optical phasespace");
+  fSourceModeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fOmniMarginCmd = new G4UIcmdWithADoubleAndUnit("/CompScintSim/generator/omniMargin", this);
+  fOmniMarginCmd->SetGuidance("Margin added around the detector bounding box for the omni source");
+  fOmniMarginCmd->SetParameterName("margin", false);
+  fOmniMarginCmd->SetRange("margin>=0.");
+  fOmniMarginCmd->SetUnitCategory("Length");
+  fOmniMarginCmd->SetDefaultUnit("mm");
+  fOmniMarginCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fReplayFileCmd = new G4UIcmdWithAString("/CompScintSim/generator/replayFile", this);
+  fReplayFileCmd->SetGuidance("Set the primary file used by the replay source.");
+  fReplayFileCmd->SetGuidance("  Event k replays event (k mod N) of the file.");
+  fReplayFileCmd->SetParameterName("fileName", false);
+  fReplayFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fPhaseSpaceFileCmd = new G4UIcmdWithAString("/CompScintSim/generator/phaseSpaceFile", this);
+  fPhaseSpaceFileCmd->SetGuidance("Set the phase-space file used by the phasespace source.");
+  fPhaseSpaceFileCmd->SetGuidance("  Event k starts from the particles of source event (k mod N) on the plane.");
+  fPhaseSpaceFileCmd->SetParameterName("fileName", false);
+  fPhaseSpaceFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fOpticalLayerCmd = new G4UIcmdWithAnInteger("/CompScintSim/generator/optical/layer", this);
+  fOpticalLayerCmd->SetGuidance("Copy number N of the scint_layer_N volume emitting optical photons");
+  fOpticalLayerCmd->SetParameterName("copynumber", false);
+  fOpticalLayerCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fOpticalPhotonsCmd = new G4UIcmdWithAnInteger("/CompScintSim/generator/optical/photonsPerEvent", this);
+  fOpticalPhotonsCmd->SetGuidance("Number of optical photons emitted per event");
+  fOpticalPhotonsCmd->SetParameterName("nPhotons", false);
+  fOpticalPhotonsCmd->SetRange("nPhotons>0");
+  fOpticalPhotonsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fOpticalChunkCmd = new G4UIcmdWithAnInteger("/CompScintSim/generator/optical/chunkSize", this);
+  fOpticalChunkCmd->SetGuidance("Maximum number of source photons pushed to the stack at once");
+  fOpticalChunkCmd->SetParameterName("chunkSize", false);
+  fOpticalChunkCmd->SetRange("chunkSize>0");
+  fOpticalChunkCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
   
   // 创建GPS源相关命令
   // 添加GPS源命令
@@ -107,6 +158,13 @@ CompScintSimPrimaryGeneratorMessenger::~CompScintSimPrimaryGeneratorMessenger()
   delete fPolarCmd;
   delete fGunDir;
   delete fSetUseParticleGunCmd;
+  delete fSourceModeCmd;
+  delete fOmniMarginCmd;
+  delete fReplayFileCmd;
+  delete fPhaseSpaceFileCmd;
+  delete fOpticalLayerCmd;
+  delete fOpticalPhotonsCmd;
+  delete fOpticalChunkCmd;
   
   // 删除GPS源相关命令
   delete fAddGPSSourceCmd;
@@ -123,6 +181,33 @@ void CompScintSimPrimaryGeneratorMessenger::SetNewValue(G4UIcommand* command, G4
     myPrint(DEBUG, fmt("Setting particle generator: useParticleGun = {}", useGun ? "true" : "false"));
     fCompScintSimAction->SetUseParticleGun(useGun);
   }
+  else if (command == fSourceModeCmd) {
+    myPrint(DEBUG, fmt("Setting source mode: {}", newValue));
+    if (newValue == "gun") fCompScintSimAction->SetSourceMode(SourceMode::ParticleGun);
+    else if (newValue == "gps") fCompScintSimAction->SetSourceMode(SourceMode::GPS);
+    else if (newValue == "omni") fCompScintSimAction->SetSourceMode(SourceMode::Omni);
+    else if (newValue == "replay") fCompScintSimAction->SetSourceMode(SourceMode::Replay);
+    else if (newValue == "optical") fCompScintSimAction->SetSourceMode(SourceMode::OpticalPhoton);
+    else if (newValue == "phasespace") fCompScintSimAction->SetSourceMode(SourceMode::PhaseSpace);
+  }
+  else if (command == fPhaseSpaceFileCmd) {
+    fCompScintSimAction->SetPhaseSpaceFile(newValue);
+  }
+  else if (command == fOpticalLayerCmd) {
+    fCompScintSimAction->GetOpticalSource()->SetLayer(fOpticalLayerCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fOpticalPhotonsCmd) {
+    fCompScintSimAction->GetOpticalSource()->SetPhotonsPerEvent(fOpticalPhotonsCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fOpticalChunkCmd) {
+    fCompScintSimAction->GetOpticalSource()->SetChunkSize(fOpticalChunkCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fReplayFileCmd) {
+    fCompScintSimAction->SetReplayFile(newValue);
+  }
+  else if (command == fOmniMarginCmd) {
+    fCompScintSimAction->SetOmniMargin(fOmniMarginCmd->GetNewDoubleValue(newValue));
+  }
   else if (command == fAddGPSSourceCmd) {
     // 解析命令参数
     std::istringstream is(newValue);
@@ -36,6 +36,13 @@
 #include "G4Run.hh"
 #include "G4UnitsTable.hh"
 #include "G4AccumulableManager.hh"
+#include "G4Event.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Threading.hh"
+#include "MyEventInfo.hh"
+
+#include <algorithm>
+#include <iomanip>
 
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -45,6 +52,15 @@ CompScintSimRun::CompScintSimRun()
 {
   fParticle             = nullptr;
   fEnergy               = -1.;
+  fSumWeight            = 0.;
+  fSumWeight2           = 0.;
+  fSumFluence           = 0.;
+  fAcceptedEvents       = 0;
+  fSteps                = 0;
+  fOpticalPhotonSteps   = 0;
+  fStartTime            = -1.;
+  // 运行由各线程自己的RunAction::GenerateRun创建，没有分到事件的线程也有负载记录
+  fLoad.threadId        = G4Threading::G4GetThreadId();
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -63,16 +79,111 @@ void CompScintSimRun::SetPrimary(G4ParticleDefinition* particle, G4double energy
 
 void CompScintSimRun::Merge(const G4Run* aRun)
 {
+  const CompScintSimRun* localRun = static_cast<const CompScintSimRun*>(aRun);
+  fSumWeight  += localRun->fSumWeight;
+  fSumWeight2 += localRun->fSumWeight2;
+  fSumFluence += localRun->fSumFluence;
+  fAcceptedEvents += localRun->fAcceptedEvents;
+  fSteps += localRun->fSteps;
+  fOpticalPhotonSteps += localRun->fOpticalPhotonSteps;
+  fThreadLoads.push_back(localRun->fLoad);
+  for (const auto& aborted : localRun->fAbortedEvents) fAbortedEvents[aborted.first] += aborted.second;
+
   G4Run::Merge(aRun);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
-void CompScintSimRun::EndOfRun()
+void CompScintSimRun::EndOfRun() const
+{
+  if (fAcceptedEvents == 0 || fSumWeight <= 0.) return;
+
+  // 被中止的事件不计入权重之和，平均权重也只对未中止的事件求平均
+  G4cout << "--------------------- Event weights ---------------------" << G4endl;
+  G4cout << " Events: " << fAcceptedEvents;
+  if (fAcceptedEvents < numberOfEvent) G4cout << " (" << numberOfEvent - fAcceptedEvents << " aborted, excluded)";
+  G4cout << ", sum of weights: " << fSumWeight
+         << ", mean weight: " << fSumWeight / fAcceptedEvents
+         << ", effective events: " << fSumWeight * fSumWeight / fSumWeight2 << G4endl;
+  if (fSumFluence > 0.) {
+    G4cout << " Equivalent isotropic fluence: " << fSumFluence * cm2 << " /cm2" << G4endl;
+  }
+  G4cout << "---------------------------------------------------------" << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimRun::AddEventTime(G4double start, G4double end)
+{
+  fLoad.events++;
+  fLoad.busy += end - start;
+  fLoad.lastEventEnd = std::max(fLoad.lastEventEnd, end);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimRun::PrintThreadLoads() const
 {
+  // 顺序模式下只有主线程自己的负载
+  std::vector<ThreadLoad> loads = fThreadLoads;
+  if (loads.empty() && fLoad.events > 0) loads.push_back(fLoad);
+  if (loads.empty() || fStartTime < 0.) return;
+  std::sort(loads.begin(), loads.end(),
+            [](const ThreadLoad& a, const ThreadLoad& b) { return a.threadId < b.threadId; });
+
+  // 尾部空闲：该线程最后一个事件结束到全部事件结束之间的时间，没有事件的线程整个事件循环都空闲
+  G4double runEnd = fStartTime;
+  G4double sumBusy = 0.;
+  for (auto& load : loads) {
+    if (load.events == 0) load.lastEventEnd = fStartTime;
+    runEnd = std::max(runEnd, load.lastEventEnd);
+    sumBusy += load.busy;
+  }
+  G4double span = runEnd - fStartTime;
 
+  G4cout << "---------------------- Thread load ----------------------" << G4endl;
+  G4cout << " Thread   Events   Busy [s]   Tail idle [s]" << G4endl;
+  for (const auto& load : loads) {
+    G4cout << std::setw(7) << load.threadId << std::setw(9) << load.events
+           << std::setw(11) << std::fixed << std::setprecision(3) << load.busy
+           << std::setw(16) << runEnd - load.lastEventEnd << std::defaultfloat << G4endl;
+  }
+  if (span > 0.) {
+    G4cout << " Event loop: " << span << " s, utilization: "
+           << 100. * sumBusy / (span * loads.size()) << " %" << G4endl;
+  }
+  G4cout << "---------------------------------------------------------" << G4endl;
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimRun::RecordEvent(const G4Event* event)
+{
+  // 中止的事件不写入输出，也不计入权重
+  if (event->IsAborted()) {
+    G4Run::RecordEvent(event);
+    return;
+  }
+
+  G4double weight = 1.;
+  auto eventInfo = dynamic_cast<MyEventInfo*>(event->GetUserInformation());
+  if (eventInfo) {
+    weight = eventInfo->GetWeight();
+    fSumFluence += eventInfo->GetFluencePerPrimary();
+  }
+  fSumWeight  += weight;
+  fSumWeight2 += weight * weight;
+  fAcceptedEvents++;
 
-void CompScintSimRun::RecordEvent(const G4Event* )
+  G4Run::RecordEvent(event);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimRun::PrintAbortedEvents() const
 {
-}
\ No newline at end of file
+  if (fAbortedEvents.empty()) return;
+
+  G4int total = 0;
+  for (const auto& aborted : fAbortedEvents) total += aborted.second;
+  G4cout << " Aborted events: " << total << " (";
+  for (auto it = fAbortedEvents.begin(); it != fAbortedEvents.end(); ++it) {
+    G4cout << (it == fAbortedEvents.begin() ? "" : ", ") << it->first << ": " << it->second;
+  }
+  G4cout << "), excluded from the output, see the status column of the event index" << G4endl;
+}
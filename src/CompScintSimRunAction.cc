@@ -43,12 +43,39 @@
 #include "G4Threading.hh"
 
 #include "CompScintSimRunActionMessenger.hh"
+#include "CompScintSimPhysicsList.hh"
+#include "EventReplay.hh"
+#include "EventSeeder.hh"
+#include "EventWatchdog.hh"
+#include "OpticalPhotonScheduler.hh"
+#include "PhysicsTableCache.hh"
+#include "StartupBenchmark.hh"
+#include "ThreadPinning.hh"
+#include "G4RunManager.hh"
 
 #include "config.hh"
+#include "utilities.hh"
 #include "ScintillatorLayerManager.hh"
 
 #include <chrono>
+#include <functional>
 #include <iomanip>
+#include <memory>
+#include <queue>
+
+namespace
+{
+  // 读取线程CSV文件的下一行，取出行首的eventID
+  G4bool ReadEventRow(std::ifstream& file, std::string& line, G4int& eventID)
+  {
+    while (std::getline(file, line)) {
+      if (line.empty()) continue;
+      eventID = std::atoi(line.c_str());
+      return true;
+    }
+    return false;
+  }
+}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 CompScintSimRunAction::CompScintSimRunAction(CompScintSimPrimaryGeneratorAction *prim)
@@ -57,13 +84,6 @@ CompScintSimRunAction::CompScintSimRunAction(CompScintSimPrimaryGeneratorAction
   // 创建Messenger
   fMessenger = new CompScintSimRunActionMessenger(this);
   fSaveFileName = "default.csv"; // 默认文件名，带后缀
-
-  // 初始化闪烁体层管理器
-  ScintillatorLayerManager& layerManager = ScintillatorLayerManager::GetInstance();
-  if (!layerManager.IsInitialized())
-  {
-    layerManager.Initialize(g_ScintillatorGeometry);
-  }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -81,6 +101,34 @@ G4Run *CompScintSimRunAction::GenerateRun()
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void CompScintSimRunAction::BeginOfRunAction(const G4Run* run)
 {
+  fTimer.Start();
+  StartupBenchmark::MarkRunStart();
+
+  // run开始时输出物理设置；物理表此时已经建立，首次运行时写入缓存
+  if (isMaster) {
+    if (fRun) fRun->SetStartTime(StartupBenchmark::Elapsed());
+    PhysicsTableCache::Store();
+    auto physicsList = dynamic_cast<const CompScintSimPhysicsList*>(
+        G4RunManager::GetRunManager()->GetUserPhysicsList());
+    if (physicsList) {
+      G4cout << " Run " << run->GetRunID() << " physics: " << physicsList->GetPresetName() << G4endl
+             << " Optical: " << physicsList->GetOpticalSummary() << G4endl;
+    }
+    G4cout << " Run " << run->GetRunID() << " seed: " << EventSeeder::GetRunSeed()
+           << " (-r " << EventSeeder::GetRunSeed() << " to reproduce)" << G4endl;
+    if (EventWatchdog::IsEnabled()) {
+      G4cout << " Event budget: " << (EventWatchdog::GetTimeLimit() > 0. ? std::to_string(EventWatchdog::GetTimeLimit()) + " s" : "no time limit")
+             << ", " << (EventWatchdog::GetStepLimit() > 0 ? std::to_string(EventWatchdog::GetStepLimit()) + " steps" : "no step limit")
+             << G4endl;
+    }
+    if (OpticalPhotonScheduler::IsEnabled()) {
+      G4cout << " Optical photons dispatched in batches of " << OpticalPhotonScheduler::GetBatchSize() << G4endl;
+    }
+  }
+  else {
+    OpticalPhotonScheduler::BeginOfRun();
+  }
+
   // 创建线程专用的CSV文件名
   G4int threadID = G4Threading::G4GetThreadId();
   std::stringstream csvFilename;
@@ -88,30 +136,38 @@ void CompScintSimRunAction::BeginOfRunAction(const G4Run* run)
   fThreadCsvFileName = csvFilename.str();
   
   // 获取层信息
-  ScintillatorLayerManager& layerManager = ScintillatorLayerManager::GetInstance();
-  std::vector<G4int> copynumbers = layerManager.GetCopynumbers();
+  const std::vector<G4int>& copynumbers = ScintillatorLayerManager::GetInstance().GetSnapshot().copynumber;
   
   // 为每个线程创建CSV文件并写入表头
   std::ofstream outFile(fThreadCsvFileName, std::ios::out);
   
-  // 写入CSV表头（copynumber列表）
+  // 写入CSV表头（事件索引，copynumber列表，最后一列为事件权重）
+  outFile << "event,engine_seed1,engine_seed2,aux_seed,primaries,particle,energy_MeV,status,time_s,";
   for (size_t i = 0; i < copynumbers.size(); i++) {
-    outFile << copynumbers[i];
-    if (i < copynumbers.size() - 1) {
-      outFile << ",";
-    }
+    outFile << copynumbers[i] << ",";
   }
-  outFile << "\n";
+  outFile << "weight\n";
   outFile.close();
   
   G4cout << "Thread " << threadID << " created CSV file: " << fThreadCsvFileName << G4endl;
 
+  // 初级粒子转储：每个线程写入自己的临时文件，运行结束时由主线程合并
+  // 顺序模式下只有主线程，由其直接写入
+  if (!fPrimaryDumpFileName.empty() && (!isMaster || !G4Threading::IsMultithreadedApplication())) {
+    std::stringstream partFileName;
+    partFileName << "thread" << threadID << "_" << fPrimaryDumpFileName << ".part";
+    fPrimaryWriter.Open(partFileName.str());
+  }
+
+  // 相空间记录，临时文件的规则与初级粒子转储相同
+  fPhaseSpaceRecorder.BeginOfRun(threadID, !isMaster || !G4Threading::IsMultithreadedApplication());
+
   if (fPrimary)
   {
     G4double energy;
     G4ParticleDefinition *particle;
 
-    fPrimary->isInitialized = false;
+    fPrimary->ResetGeometry();
     if (fPrimary->GetUseParticleGun())
     {
       particle = fPrimary->GetParticleGun()->GetParticleDefinition();
@@ -135,33 +191,86 @@ void CompScintSimRunAction::EndOfRunAction(const G4Run* run)
   
   G4cout << "Run " << runID << " ended on thread " << threadID << G4endl;
 
+  // 处理完自己的事件后，帮助其他线程处理光学光子批，须在关闭临时文件之前
+  if (!isMaster) OpticalPhotonScheduler::HelpUntilRunEnd();
+
+  // 关闭线程的初级粒子临时文件，确保主线程合并前数据已写出
+  fPrimaryWriter.Close();
+  fPhaseSpaceRecorder.EndOfRun();
+
+  // 输出本线程缓冲的日志
+  FlushLog();
+
   // 主线程负责合并所有线程的CSV文件
   if (isMaster) {
+    // 输出事件权重统计
+    static_cast<const CompScintSimRun*>(run)->EndOfRun();
+
+    // 第一个run结束时输出启动时间线
+    StartupBenchmark::ReportTimeline();
+
+    // 步数和墙钟时间，光学光子输运速度为各线程步数之和 / 主线程墙钟时间
+    fTimer.Stop();
+    const CompScintSimRun* localRun = static_cast<const CompScintSimRun*>(run);
+    if (run->GetNumberOfEvent() > 0) {
+      G4cout << " Steps: " << localRun->GetSteps()
+             << " (" << static_cast<G4double>(localRun->GetSteps()) / run->GetNumberOfEvent() << " per event)"
+             << ", wall time: " << fTimer.GetRealElapsed() << " s" << G4endl;
+      if (fTimer.GetRealElapsed() > 0.) {
+        G4cout << " Events/s: " << run->GetNumberOfEvent() / fTimer.GetRealElapsed() << G4endl;
+      }
+    }
+    localRun->PrintThreadLoads();
+    localRun->PrintAbortedEvents();
+    ThreadPinning::Report();
+    G4long opticalSteps = localRun->GetOpticalPhotonSteps();
+    if (opticalSteps > 0 && fTimer.GetRealElapsed() > 0.) {
+      G4cout << " Optical photon steps: " << opticalSteps
+             << " in " << fTimer.GetRealElapsed() << " s, "
+             << opticalSteps / fTimer.GetRealElapsed() << " steps/s" << G4endl;
+    }
+
     G4String finalCsvFileName = getNewfileName(fSaveFileName, "");
     
     // 获取层信息，用于写入合并后文件的表头
-    ScintillatorLayerManager& layerManager = ScintillatorLayerManager::GetInstance();
-    std::vector<G4int> copynumbers = layerManager.GetCopynumbers();
+    const std::vector<G4int>& copynumbers = ScintillatorLayerManager::GetInstance().GetSnapshot().copynumber;
     
     // 创建最终的CSV文件并写入表头
     std::ofstream finalFile(finalCsvFileName, std::ios::out);
     for (size_t i = 0; i < copynumbers.size(); i++) {
-      finalFile << copynumbers[i];
-      if (i < copynumbers.size() - 1) {
-        finalFile << ",";
-      }
+      finalFile << copynumbers[i] << ",";
     }
-    finalFile << "\n";
+    finalFile << "weight\n";
     
+    // 事件索引单独写入<输出文件>_index.csv，每行可用于单独重放该事件（/CompScintSim/replay）
+    G4String indexFileName = finalCsvFileName;
+    if (indexFileName.size() > 4 && indexFileName.substr(indexFileName.size() - 4) == ".csv") {
+      indexFileName.erase(indexFileName.size() - 4);
+    }
+    indexFileName += "_index.csv";
+    std::ofstream indexFile(indexFileName, std::ios::out);
+    indexFile << "run_seed,run,event,engine_seed1,engine_seed2,aux_seed,primaries,particle,energy_MeV,"
+                 "status,time_s\n";
+    G4int slowestEvent = -1;
+    G4double slowestTime = 0.;
+    // 重放的事件记录原事件的runID
+    G4int indexRunID = EventReplay::IsActive() ? EventReplay::GetRunID() : runID;
+
     // 合并所有线程的CSV文件，包括主线程(ID=-1)
     // 注意：GetNumberOfRunningWorkerThreads()不包括主线程
+    // 每个线程按eventID递增的顺序处理事件，按eventID归并后的文件与线程数和调度无关
     G4int maxThread = G4Threading::GetNumberOfRunningWorkerThreads();
+    std::vector<G4String> threadFileNames;
+    std::vector<std::unique_ptr<std::ifstream>> threadFiles;
+    std::vector<std::string> threadRows;
+    std::priority_queue<std::pair<G4int, size_t>, std::vector<std::pair<G4int, size_t>>,
+                        std::greater<std::pair<G4int, size_t>>> nextRows;
     for (G4int tid = -1; tid < maxThread; tid++) {
       std::stringstream threadCsvFileName;
       threadCsvFileName << "thread" << tid << "_" << fSaveFileName;
       
-      std::ifstream threadFile(threadCsvFileName.str());
-      if (!threadFile.is_open()) {
+      auto threadFile = std::make_unique<std::ifstream>(threadCsvFileName.str());
+      if (!threadFile->is_open()) {
         if (tid != -1) { // 如果不是主线程，则输出警告信息
           G4cout << "Warning: Could not open thread file " << threadCsvFileName.str() << G4endl;
         }
@@ -169,26 +278,112 @@ void CompScintSimRunAction::EndOfRunAction(const G4Run* run)
       }
       
       // 跳过表头
-      std::string header;
-      std::getline(threadFile, header);
-      
-      // 复制所有数据行到最终文件
       std::string line;
-      while (std::getline(threadFile, line)) {
-        finalFile << line << "\n";
+      std::getline(*threadFile, line);
+
+      G4int eventID = 0;
+      if (ReadEventRow(*threadFile, line, eventID)) {
+        nextRows.emplace(eventID, threadFiles.size());
+      }
+      threadFileNames.push_back(threadCsvFileName.str());
+      threadFiles.push_back(std::move(threadFile));
+      threadRows.push_back(line);
+    }
+
+    // 事件索引列写入索引文件，其余写入最终文件
+    while (!nextRows.empty()) {
+      G4int eventID = nextRows.top().first;
+      size_t index = nextRows.top().second;
+      nextRows.pop();
+
+      const std::string& row = threadRows[index];
+      size_t split = 0;
+      for (G4int column = 0; column < kEventIndexColumns && split != std::string::npos; column++) {
+        split = row.find(',', split);
+        if (split != std::string::npos) split++;
+      }
+      if (split != std::string::npos) {
+        indexFile << EventSeeder::GetRunSeed() << "," << indexRunID << "," << row.substr(0, split - 1) << "\n";
+        // 状态为索引的倒数第二列，被中止的事件不写入最终文件
+        size_t timeStart = row.rfind(',', split - 2) + 1;
+        size_t statusStart = row.rfind(',', timeStart - 2) + 1;
+        if (row.compare(statusStart, timeStart - 1 - statusStart, "ok") == 0) {
+          finalFile << row.substr(split) << "\n";
+        }
+
+        // 耗时为索引的最后一列
+        G4double time = std::atof(row.c_str() + timeStart);
+        if (slowestEvent < 0 || time > slowestTime) {
+          slowestEvent = eventID;
+          slowestTime = time;
+        }
+      }
+
+      if (ReadEventRow(*threadFiles[index], threadRows[index], eventID)) {
+        nextRows.emplace(eventID, index);
       }
-      
-      threadFile.close();
-      
-      // 删除线程临时文件
-      std::remove(threadCsvFileName.str().c_str());
     }
+    indexFile.close();
     
     finalFile.close();
-    G4cout << "All thread data merged into final CSV file: " << finalCsvFileName << G4endl;
+
+    // 删除线程临时文件
+    threadFiles.clear();
+    for (const auto& threadFileName : threadFileNames) {
+      std::remove(threadFileName.c_str());
+    }
+    G4cout << "All thread data merged into final CSV file: " << finalCsvFileName
+           << " (event index: " << indexFileName << ")" << G4endl;
+    if (slowestEvent >= 0) {
+      G4cout << " Slowest event: " << slowestEvent << " (" << slowestTime << " s), replay with "
+             << "/CompScintSim/replay " << indexRunID << " " << slowestEvent << G4endl;
+    }
+
+    // 合并各线程的初级粒子文件
+    if (!fPrimaryDumpFileName.empty()) {
+      std::vector<G4String> partFileNames;
+      for (G4int tid = -1; tid < maxThread; tid++) {
+        std::stringstream partFileName;
+        partFileName << "thread" << tid << "_" << fPrimaryDumpFileName << ".part";
+        partFileNames.push_back(partFileName.str());
+      }
+      PrimaryFileWriter::Merge(partFileNames, fPrimaryDumpFileName, run->GetNumberOfEvent());
+    }
+
+    // 合并各线程的相空间文件，每个平面一个文件
+    if (fPhaseSpaceRecorder.IsEnabled()) {
+      for (size_t plane = 0; plane < fPhaseSpaceRecorder.GetNumberOfPlanes(); plane++) {
+        std::vector<G4String> partFileNames;
+        for (G4int tid = -1; tid < maxThread; tid++) {
+          partFileNames.push_back(fPhaseSpaceRecorder.GetPartFileName(tid, plane));
+        }
+        PrimaryFileWriter::Merge(partFileNames, fPhaseSpaceRecorder.GetPlaneFileName(plane), run->GetNumberOfEvent());
+      }
+    }
   }
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void CompScintSimRunAction::CountStep(G4bool opticalPhoton)
+{
+  if (fRun) fRun->AddStep(opticalPhoton);
+}
+
+void CompScintSimRunAction::CountSteps(G4long steps, G4long opticalPhotonSteps)
+{
+  if (fRun) fRun->AddSteps(steps, opticalPhotonSteps);
+}
+
+void CompScintSimRunAction::CountEventTime(G4double start, G4double end)
+{
+  if (fRun) fRun->AddEventTime(start, end);
+}
+
+void CompScintSimRunAction::CountAbortedEvent(const G4String& reason)
+{
+  if (fRun) fRun->AddAbortedEvent(reason);
+}
+
 bool CompScintSimRunAction::fileExists(const G4String &fileName)
 {
   std::ifstream file(fileName.c_str());
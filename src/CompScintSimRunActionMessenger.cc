@@ -1,8 +1,22 @@
 #include "CompScintSimRunActionMessenger.hh"
 #include "CompScintSimRunAction.hh"
+#include "EventReplay.hh"
+#include "EventSeeder.hh"
+#include "EventWatchdog.hh"
+#include "OpticalPhotonScheduler.hh"
+#include "ThreadPinning.hh"
 #include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithoutParameter.hh"
 #include "G4UIdirectory.hh"
 #include "G4UIcommand.hh"
+#include "G4UIparameter.hh"
+#include "G4Exception.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <sstream>
 
 // ------------------------------------------------------------------
 //
@@ -27,12 +41,125 @@ CompScintSimRunActionMessenger::CompScintSimRunActionMessenger(CompScintSimRunAc
     fSetFileNameCmd->SetGuidance("Set output file name");
     fSetFileNameCmd->SetParameterName("filename", false); // false表示必须提供参数
     fSetFileNameCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    // 转储每个事件的初级粒子，供 /CompScintSim/generator/source replay 重放
+    fDumpPrimariesCmd = new G4UIcmdWithAString("/MySim/dumpPrimaries", this);
+    fDumpPrimariesCmd->SetGuidance("Write the primaries of every event to a binary file (none to disable)");
+    fDumpPrimariesCmd->SetGuidance("The file can be replayed with /CompScintSim/generator/replayFile");
+    fDumpPrimariesCmd->SetParameterName("filename", false);
+    fDumpPrimariesCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    // 层间相空间，供 /CompScintSim/generator/source phasespace 从平面处重新开始模拟
+    fPhaseSpaceDir = new G4UIdirectory("/MySim/phaseSpace/");
+    fPhaseSpaceDir->SetGuidance("Phase-space recording at z-planes between layers");
+
+    fPhaseSpaceFileCmd = new G4UIcmdWithAString("/MySim/phaseSpace/file", this);
+    fPhaseSpaceFileCmd->SetGuidance("Phase-space output file, plane i is written to <name>_plane<i><ext> (none to disable)");
+    fPhaseSpaceFileCmd->SetParameterName("filename", false);
+    fPhaseSpaceFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fAddPlaneCmd = new G4UIcmdWithADoubleAndUnit("/MySim/phaseSpace/addPlane", this);
+    fAddPlaneCmd->SetGuidance("Record particles crossing downward the plane at the given z");
+    fAddPlaneCmd->SetParameterName("z", false);
+    fAddPlaneCmd->SetUnitCategory("Length");
+    fAddPlaneCmd->SetDefaultUnit("mm");
+    fAddPlaneCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fAddPlaneBelowLayerCmd = new G4UIcmdWithAnInteger("/MySim/phaseSpace/addPlaneBelowLayer", this);
+    fAddPlaneBelowLayerCmd->SetGuidance("Record particles leaving downward the bottom surface of layer N");
+    fAddPlaneBelowLayerCmd->SetParameterName("copynumber", false);
+    fAddPlaneBelowLayerCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fClearPlanesCmd = new G4UIcmdWithoutParameter("/MySim/phaseSpace/clearPlanes", this);
+    fClearPlanesCmd->SetGuidance("Remove all phase-space planes");
+    fClearPlanesCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fKillAtPlaneCmd = new G4UIcmdWithABool("/MySim/phaseSpace/killAtPlane", this);
+    fKillAtPlaneCmd->SetGuidance("Stop particles once they are recorded on a plane");
+    fKillAtPlaneCmd->SetParameterName("kill", true);
+    fKillAtPlaneCmd->SetDefaultValue(true);
+    fKillAtPlaneCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    // 工作线程在/run/initialize时创建，绑定策略须在此之前设置
+    fPinThreadsCmd = new G4UIcmdWithAString("/MySim/pinThreads", this);
+    fPinThreadsCmd->SetGuidance("Pin worker threads to cores: none, compact, scatter or a list like 0,2,4-7");
+    fPinThreadsCmd->SetParameterName("policy", false);
+    fPinThreadsCmd->AvailableForStates(G4State_PreInit);
+    fPinThreadsCmd->SetToBeBroadcasted(false);
+
+    // 64位种子超出整数参数的范围，以字符串给出；工作线程在事件开始时读取
+    fRunSeedCmd = new G4UIcmdWithAString("/MySim/runSeed", this);
+    fRunSeedCmd->SetGuidance("Set the 64-bit run seed (decimal or 0x hex) from which every event is seeded");
+    fRunSeedCmd->SetGuidance("Results are then independent of the number of threads and the run manager type");
+    fRunSeedCmd->SetParameterName("seed", false);
+    fRunSeedCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+    fRunSeedCmd->SetToBeBroadcasted(false);
+
+    // 重放由主线程执行一个只含该事件的run，不能广播到工作线程
+    fReplayCmd = new G4UIcommand("/CompScintSim/replay", this);
+    fReplayCmd->SetGuidance("Re-simulate one event of a previous run from its recorded seeds");
+    fReplayCmd->SetGuidance("The run seed and the source settings must be the same as in the original run");
+    fReplayCmd->SetGuidance("trackingVerbose > 0 prints every step, photonFile receives one row per optical photon track");
+    G4UIparameter* runParam = new G4UIparameter("run", 'i', false);
+    runParam->SetParameterRange("run >= 0");
+    fReplayCmd->SetParameter(runParam);
+    G4UIparameter* eventParam = new G4UIparameter("eventID", 'i', false);
+    eventParam->SetParameterRange("eventID >= 0");
+    fReplayCmd->SetParameter(eventParam);
+    G4UIparameter* verboseParam = new G4UIparameter("trackingVerbose", 'i', true);
+    verboseParam->SetDefaultValue(0);
+    fReplayCmd->SetParameter(verboseParam);
+    G4UIparameter* photonParam = new G4UIparameter("photonFile", 's', true);
+    photonParam->SetDefaultValue("none");
+    fReplayCmd->SetParameter(photonParam);
+    fReplayCmd->AvailableForStates(G4State_Idle);
+    fReplayCmd->SetToBeBroadcasted(false);
+
+    // 预算为所有线程共用，由主线程设置
+    fEventTimeLimitCmd = new G4UIcmdWithADoubleAndUnit("/MySim/eventTimeLimit", this);
+    fEventTimeLimitCmd->SetGuidance("Abort events that run longer than this wall time (0 for no limit)");
+    fEventTimeLimitCmd->SetGuidance("Aborted events are left out of the output and flagged in the event index");
+    fEventTimeLimitCmd->SetParameterName("time", false);
+    fEventTimeLimitCmd->SetRange("time>=0.");
+    fEventTimeLimitCmd->SetUnitCategory("Time");
+    fEventTimeLimitCmd->SetDefaultUnit("s");
+    fEventTimeLimitCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+    fEventTimeLimitCmd->SetToBeBroadcasted(false);
+
+    fEventStepLimitCmd = new G4UIcmdWithAnInteger("/MySim/eventStepLimit", this);
+    fEventStepLimitCmd->SetGuidance("Abort events that take more steps than this, all particles counted (0 for no limit)");
+    fEventStepLimitCmd->SetParameterName("steps", false);
+    fEventStepLimitCmd->SetRange("steps>=0");
+    fEventStepLimitCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+    fEventStepLimitCmd->SetToBeBroadcasted(false);
+
+    // 批的大小为所有线程共用，由主线程设置
+    fPhotonBatchSizeCmd = new G4UIcmdWithAnInteger("/MySim/photonBatchSize", this);
+    fPhotonBatchSizeCmd->SetGuidance("Hand the optical photons of an event to idle threads in batches of this size (0 to disable)");
+    fPhotonBatchSizeCmd->SetGuidance("Every batch is seeded from the event seed and its index, results do not depend on the threads");
+    fPhotonBatchSizeCmd->SetParameterName("photons", false);
+    fPhotonBatchSizeCmd->SetRange("photons>=0");
+    fPhotonBatchSizeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+    fPhotonBatchSizeCmd->SetToBeBroadcasted(false);
 }
 
 //----------------------------------------------------------------------------//
 CompScintSimRunActionMessenger::~CompScintSimRunActionMessenger()
 {
     delete fSetFileNameCmd;
+    delete fDumpPrimariesCmd;
+    delete fPhaseSpaceFileCmd;
+    delete fAddPlaneCmd;
+    delete fAddPlaneBelowLayerCmd;
+    delete fClearPlanesCmd;
+    delete fKillAtPlaneCmd;
+    delete fPinThreadsCmd;
+    delete fRunSeedCmd;
+    delete fReplayCmd;
+    delete fEventTimeLimitCmd;
+    delete fEventStepLimitCmd;
+    delete fPhotonBatchSizeCmd;
+    delete fPhaseSpaceDir;
     // 如果有 simDir, 需要根据实际写法决定是否要 delete
 }
 
@@ -42,4 +169,51 @@ void CompScintSimRunActionMessenger::SetNewValue(G4UIcommand* command, G4String
     if(command == fSetFileNameCmd) {
         fRunAction->SetSaveFileName(newValue);
     }
+    else if(command == fDumpPrimariesCmd) {
+        fRunAction->SetPrimaryDumpFileName(newValue == "none" ? G4String() : newValue);
+    }
+    else if(command == fPhaseSpaceFileCmd) {
+        fRunAction->GetPhaseSpaceRecorder()->SetFileName(newValue == "none" ? G4String() : newValue);
+    }
+    else if(command == fAddPlaneCmd) {
+        fRunAction->GetPhaseSpaceRecorder()->AddPlane(fAddPlaneCmd->GetNewDoubleValue(newValue));
+    }
+    else if(command == fAddPlaneBelowLayerCmd) {
+        fRunAction->GetPhaseSpaceRecorder()->AddPlaneBelowLayer(fAddPlaneBelowLayerCmd->GetNewIntValue(newValue));
+    }
+    else if(command == fClearPlanesCmd) {
+        fRunAction->GetPhaseSpaceRecorder()->ClearPlanes();
+    }
+    else if(command == fKillAtPlaneCmd) {
+        fRunAction->GetPhaseSpaceRecorder()->SetKillAtPlane(fKillAtPlaneCmd->GetNewBoolValue(newValue));
+    }
+    else if(command == fPinThreadsCmd) {
+        ThreadPinning::SetPolicy(newValue);
+    }
+    else if(command == fRunSeedCmd) {
+        std::uint64_t seed = 0;
+        if (!EventSeeder::ParseSeed(newValue, seed)) {
+            G4ExceptionDescription ed;
+            ed << "Invalid run seed \"" << newValue << "\", use a decimal or 0x hex 64-bit integer";
+            G4Exception("CompScintSimRunActionMessenger::SetNewValue", "InvalidRunSeed", FatalErrorInArgument, ed);
+            return;
+        }
+        EventSeeder::SetRunSeed(seed);
+    }
+    else if(command == fReplayCmd) {
+        G4int run = 0, eventID = 0, verbose = 0;
+        G4String photonFile;
+        std::istringstream is(newValue);
+        is >> run >> eventID >> verbose >> photonFile;
+        EventReplay::Replay(run, eventID, verbose, photonFile == "none" ? G4String() : photonFile);
+    }
+    else if(command == fEventTimeLimitCmd) {
+        EventWatchdog::SetTimeLimit(fEventTimeLimitCmd->GetNewDoubleValue(newValue) / s);
+    }
+    else if(command == fEventStepLimitCmd) {
+        EventWatchdog::SetStepLimit(fEventStepLimitCmd->GetNewIntValue(newValue));
+    }
+    else if(command == fPhotonBatchSizeCmd) {
+        OpticalPhotonScheduler::SetBatchSize(fPhotonBatchSizeCmd->GetNewIntValue(newValue));
+    }
 }
@@ -31,6 +31,10 @@
 
 #include "CompScintSimStackingAction.hh"
 #include "CompScintSimRun.hh"
+#include "CompScintSimPrimaryGeneratorAction.hh"
+#include "EventWatchdog.hh"
+#include "OpticalPhotonScheduler.hh"
+#include "G4EventManager.hh"
 #include "G4ios.hh"
 #include "G4OpticalPhoton.hh"
 #include "G4RunManager.hh"
@@ -45,8 +49,8 @@
 #include "config.hh"
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
-CompScintSimStackingAction::CompScintSimStackingAction()
-    : G4UserStackingAction(), fScintillationPhotonCount(0)
+CompScintSimStackingAction::CompScintSimStackingAction(CompScintSimPrimaryGeneratorAction *primary)
+    : G4UserStackingAction(), fPrimary(primary), fScintillationPhotonCount(0)
 {
 }
 
@@ -57,19 +61,9 @@ CompScintSimStackingAction::~CompScintSimStackingAction() {}
 G4ClassificationOfNewTrack CompScintSimStackingAction::ClassifyNewTrack(
     const G4Track *aTrack)
 {
-  if(!g_has_cherenkov){
-      if (aTrack->GetDefinition() == G4OpticalPhoton::OpticalPhotonDefinition())
-    { // particle is optical photon
-      if (aTrack->GetParentID() > 0)
-      { // particle is secondary
-        if (aTrack->GetCreatorProcess()->GetProcessName() == "Cerenkov")
-        {
-          return fKill; // kill the particle if it is created by Cerenkov process
-        }
-      }
-    }
-  }
-
+  // 不需要的切伦科夫光由物理列表在构建时关闭（/CompScintSim/optical/cerenkov），不再在这里删除
+  // 光学光子分批时，带电粒子阶段产生的光子交给调度器，在NewStage中分批处理
+  if (OpticalPhotonScheduler::Collect(aTrack)) return fKill;
   return fUrgent;
 }
 
@@ -77,12 +71,42 @@ G4ClassificationOfNewTrack CompScintSimStackingAction::ClassifyNewTrack(
 void CompScintSimStackingAction::NewStage()
 {
   // 当前阶段（堆栈）处理完后执行
+  // 光学光子源：堆栈清空后压入下一块光子，使堆栈中的光子数不超过块大小；
+  // 光子分批时源的光子一次全部交给调度器，由调度器分批压入；事件被中止后不再产生剩余的光子
+  if (fPrimary && fPrimary->GetSourceMode() == SourceMode::OpticalPhoton && !OpticalPhotonScheduler::IsHelperEvent() &&
+      !EventWatchdog::IsAborted())
+  {
+    OpticalPhotonSource *opticalSource = fPrimary->GetOpticalSource();
+    if (OpticalPhotonScheduler::IsEnabled())
+    {
+      while (opticalSource->GetPendingPhotons() > 0)
+      {
+        G4TrackVector tracks;
+        opticalSource->FillNextChunk(tracks);
+        for (G4Track *track : tracks)
+        {
+          OpticalPhotonScheduler::Collect(track);
+          delete track;
+        }
+      }
+    }
+    else if (opticalSource->GetPendingPhotons() > 0)
+    {
+      G4TrackVector tracks;
+      opticalSource->FillNextChunk(tracks);
+      G4EventManager::GetEventManager()->StackTracks(&tracks);
+    }
+  }
+
+  // 光学光子分批：交出本事件的光子，压入下一批或等待其他线程处理完
+  OpticalPhotonScheduler::NewStage();
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void CompScintSimStackingAction::PrepareNewEvent()
 {
   fScintillationPhotonCount = 0;
+  OpticalPhotonScheduler::PrepareNewEvent();
 }
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 G4int CompScintSimStackingAction::GetScintillationPhotonCount() const {
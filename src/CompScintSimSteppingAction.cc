@@ -30,6 +30,7 @@
 #include "CompScintSimSteppingAction.hh"
 #include "CompScintSimRun.hh"
 #include "CompScintSimEventAction.hh"
+#include "CompScintSimRunAction.hh"
 
 #include "G4Event.hh"
 #include "G4OpBoundaryProcess.hh"
@@ -44,18 +45,15 @@
 #include "config.hh"
 #include "ScintillatorLayerManager.hh"
 #include "MyTrackInfo.hh"
+#include "EventWatchdog.hh"
+#include "OpticalPhotonScheduler.hh"
 #include "utilities.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
-CompScintSimSteppingAction::CompScintSimSteppingAction(CompScintSimEventAction *event)
-    : G4UserSteppingAction(), fEventAction(event)
-{
-    // 初始化ScintillatorLayerManager（如果尚未初始化）
-    if (!ScintillatorLayerManager::GetInstance().IsInitialized()) {
-        ScintillatorLayerManager::GetInstance().Initialize(g_ScintillatorGeometry);
-    }
-}
+CompScintSimSteppingAction::CompScintSimSteppingAction(CompScintSimEventAction *event, CompScintSimRunAction *runAction)
+    : G4UserSteppingAction(), fEventAction(event), fRunAction(runAction)
+{}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 CompScintSimSteppingAction::~CompScintSimSteppingAction() {}
@@ -69,6 +67,23 @@ void CompScintSimSteppingAction::UserSteppingAction(const G4Step *step)
     G4StepPoint* postStepPoint = step->GetPostStepPoint();
     
     if (!preStepPoint || !postStepPoint) return;
+
+    // 层间相空间记录（须在能量沉积判断之前，层间的步通常没有能量沉积）
+    if (fRunAction && fRunAction->GetPhaseSpaceRecorder()->IsRecording()) {
+        fRunAction->GetPhaseSpaceRecorder()->ProcessStep(step);
+    }
+
+    // 统计步数（光学光子没有能量沉积，须在能量沉积判断之前）
+    static const G4ParticleDefinition *opticalphoton = G4OpticalPhoton::OpticalPhotonDefinition();
+    const G4ParticleDefinition *particleDef = track->GetParticleDefinition();
+    if (OpticalPhotonScheduler::BatchResult* batch = OpticalPhotonScheduler::GetCurrentBatch()) {
+        batch->CountStep(particleDef == opticalphoton);
+    } else if (fRunAction) {
+        fRunAction->CountStep(particleDef == opticalphoton);
+    }
+
+    // 事件的时间和步数预算
+    if (EventWatchdog::IsEnabled()) EventWatchdog::CheckStep();
     
     // 获取步骤中的能量沉积
     G4double edep = step->GetTotalEnergyDeposit();
@@ -85,12 +100,11 @@ void CompScintSimSteppingAction::UserSteppingAction(const G4Step *step)
     
     // 检查是否在闪烁体层中
     if (volumeName.find("scint_layer_") != G4String::npos) {
-        // 从名称中提取层ID
-        G4String layerIDStr = volumeName.substr(12); // 去除"scint_layer_"前缀
-        G4int layerID = std::stoi(layerIDStr);
+        // 层ID由所在层的物理体（或复制编号）得到，复制放置的层共用体积名称
+        G4int layerID = ScintillatorLayerManager::GetInstance().GetLayerCopynumber(preStepPoint->GetTouchable());
         
         // 将能量沉积添加到EventAction
-        if (fEventAction) {
+        if (fEventAction && layerID > 0) {
             fEventAction->AddEnergyDeposit(layerID, edep);
         }
     }
@@ -128,9 +142,6 @@ void CompScintSimSteppingAction::UserSteppingAction(const G4Step *step)
     
     // 光子处理
     // 判断是否是光子
-    static const G4ParticleDefinition *opticalphoton = G4OpticalPhoton::OpticalPhotonDefinition();
-    const G4ParticleDefinition *particleDef = track->GetParticleDefinition();
-    
     if (particleDef != opticalphoton) return;
     
     // 判断是否跨越几何边界
@@ -151,18 +162,21 @@ void CompScintSimSteppingAction::UserSteppingAction(const G4Step *step)
     G4String preVolumeName = preVolume->GetLogicalVolume()->GetName();
     G4String postVolumeName = postVolume->GetLogicalVolume()->GetName();
     
-    // 判断是否从晶体或世界体进入到光纤芯
+    // 判断是否从晶体或世界体（含无布尔模式下的光纤端口）进入到光纤芯
     bool isEnteringFiberCore = (postVolumeName.find("fiber_core") != G4String::npos);
     bool isFromCrystalOrWorld = (preVolumeName == "World" || 
-                               preVolumeName.find("scint_layer_") != G4String::npos);
+                               preVolumeName.find("scint_layer_") != G4String::npos ||
+                               preVolumeName.find("fiber_port_") != G4String::npos ||
+                               preVolumeName.find("LayerSlice_") != G4String::npos);
     
     // 如果不是从晶体或世界体进入光纤芯，则跳过
     if (!isEnteringFiberCore || !isFromCrystalOrWorld) {
         return;
     }
     
-    // 从光纤芯获取层号（copynumber）
-    G4int layerCopyNo = postVolume->GetCopyNo();
+    // 从光纤芯获取层号（copynumber），复制放置的层由复制编号得到
+    G4int layerCopyNo = ScintillatorLayerManager::GetInstance().GetLayerCopynumber(postStepPoint->GetTouchable());
+    if (layerCopyNo < 0) layerCopyNo = postVolume->GetCopyNo();
     
     // 添加对layerCopyNo为0的情况的详细调试
     if (layerCopyNo == 0) {
@@ -171,11 +185,13 @@ void CompScintSimSteppingAction::UserSteppingAction(const G4Step *step)
     }
     
     // 获取该层的readout_face
-    const ScintillatorLayerInfo* layerInfo = ScintillatorLayerManager::GetInstance().GetLayerInfo(layerCopyNo);
-    if (!layerInfo) {
+    const LayerSnapshot& layers = ScintillatorLayerManager::GetInstance().GetSnapshot();
+    G4int layerIndex = layers.IndexOf(layerCopyNo);
+    if (layerIndex < 0) {
         myPrint(ERROR, f("【光子跟踪】ID: %d, 无法获取层%d的信息", trackID, layerCopyNo));
         return;
     }
+    G4int readoutFace = layers.readoutFace[layerIndex];
     
     // 获取光子能量和波长
     G4double energy = track->GetTotalEnergy();
@@ -204,7 +220,7 @@ void CompScintSimSteppingAction::UserSteppingAction(const G4Step *step)
     // 由于我们关心的是光子是否从端面进入光纤，需要确保法线方向正确
     // 检查自动获取的法线是否与readout_face定义的方向一致
     G4ThreeVector expectedNormal;
-    switch (layerInfo->readout_face) {
+    switch (readoutFace) {
         case 0: // +X面
             expectedNormal = G4ThreeVector(1.0, 0.0, 0.0);
             break;
@@ -219,7 +235,7 @@ void CompScintSimSteppingAction::UserSteppingAction(const G4Step *step)
             break;
         default:
             myPrint(ERROR, f("【光子跟踪】ID: %d, 警告: 无效的readout_face值: %d", 
-                trackID, layerInfo->readout_face));
+                trackID, readoutFace));
             return;
     }
     
@@ -7,6 +7,7 @@
 
 #include "MyPhysicalVolume.hh"
 #include "MyTrackInfo.hh"
+#include "ScintillatorLayerManager.hh"
 #include "CustomScorer.hh"
 #include "utilities.hh"
 
@@ -25,7 +26,7 @@ void TotalEnergyScorer::Initialize(G4HCofThisEvent* HCE) {
 G4bool TotalEnergyScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
     G4double edep = aStep->GetTotalEnergyDeposit();
     G4int copyNo = aStep->GetPreStepPoint()->GetTouchable()->GetVolume()->GetCopyNo();
-    fHitsMap->add(copyNo, edep);
+    fHitsMap->add(copyNo, edep * aStep->GetPreStepPoint()->GetWeight());
     return true;
 }
 
@@ -61,7 +62,7 @@ G4bool PassingEnergyScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
     if (preVolume->GetName() == scorerName && momentumDirection.z() < 0 && preVolume != postVolume) {
         G4double energy = aStep->GetPreStepPoint()->GetKineticEnergy();
         G4int copyNo = preVolume->GetCopyNo();
-        fHitsMap->add(copyNo, energy);     
+        fHitsMap->add(copyNo, energy * aStep->GetPreStepPoint()->GetWeight());     
     }
     return true;
 }
@@ -106,14 +107,15 @@ G4bool TruelyPassingEnergyScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*
         return false;
     }
 
-    // 检查：preVolume是不是我们感兴趣的层？动量方向是不是向下 (z<0)？并且这一步要离开该体积 (preVolume != postVolume)？
-    if(preVolume->GetName() == scorerName &&
-       momDir.z() < 0.0 &&
+    // 检查：动量方向是不是向下 (z<0)？并且这一步要离开该体积 (preVolume != postVolume)？
+    // 探测器只收到本层闪烁体内的步；复制放置的层共用体积名称，因此不再比较体积名
+    if(momDir.z() < 0.0 &&
        preVolume != postVolume)
     {
         G4double energy = aStep->GetPreStepPoint()->GetKineticEnergy();
-        G4int copyNo = preVolume->GetCopyNo();
-        fHitsMap->add(copyNo, energy);  
+        G4int copyNo = ScintillatorLayerManager::GetInstance().GetLayerCopynumber(aStep->GetPreStepPoint()->GetTouchable());
+        if (copyNo < 0) copyNo = preVolume->GetCopyNo();
+        fHitsMap->add(copyNo, energy * aStep->GetPreStepPoint()->GetWeight());  
 
         // 标记本 Track“已经通过此层”
         trackInfo->SetHasPassedLayer(scorerName, true);
@@ -153,7 +155,7 @@ G4bool PassingEnergyScorer_Secondary::ProcessHits(G4Step* aStep, G4TouchableHist
     if (preVolume->GetName() == scorerName && momentumDirection.z() < 0 && preVolume != postVolume && parentID > 0) {
         G4double energy = aStep->GetPreStepPoint()->GetKineticEnergy();
         G4int copyNo = preVolume->GetCopyNo();
-        fHitsMap->add(copyNo, energy);     
+        fHitsMap->add(copyNo, energy * aStep->GetPreStepPoint()->GetWeight());     
     }
     return true;
 }
@@ -215,7 +217,7 @@ G4bool TruelyPassingEnergyScorer_Secondary::ProcessHits(G4Step* aStep, G4Touchab
     {
         G4double energy = aStep->GetPreStepPoint()->GetKineticEnergy();
         G4int copyNo = preVolume->GetCopyNo();
-        fHitsMap->add(copyNo, energy);  
+        fHitsMap->add(copyNo, energy * aStep->GetPreStepPoint()->GetWeight());  
 
         // 标记本 Track“已经通过此层”
         trackInfo->SetHasPassedLayer(scorerName, true);
@@ -257,7 +259,7 @@ G4bool NeutronScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
             const G4VTouchable* touchable = aStep->GetPreStepPoint()->GetTouchable();
             G4double neutronEnergy = aStep->GetPreStepPoint()->GetKineticEnergy();
             G4int copyNo = touchable->GetVolume()->GetCopyNo();
-            fHitsMap->add(copyNo, neutronEnergy);
+            fHitsMap->add(copyNo, neutronEnergy * aStep->GetPreStepPoint()->GetWeight());
         }
     }
     return true;
@@ -298,7 +300,7 @@ G4bool ElectronEnergyScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
             G4double electronEnergy = aStep->GetPreStepPoint()->GetKineticEnergy();
             const G4VTouchable* touchable = aStep->GetPreStepPoint()->GetTouchable();
             G4int copyNo = touchable->GetVolume()->GetCopyNo();
-            fHitsMap->add(copyNo, electronEnergy);
+            fHitsMap->add(copyNo, electronEnergy * aStep->GetPreStepPoint()->GetWeight());
         }
     }
     return true;
@@ -342,7 +344,7 @@ G4bool HEPhotonScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
             if (photonEnergy > 1 * CLHEP::keV) {
                 const G4VTouchable* touchable = aStep->GetPreStepPoint()->GetTouchable();
                 G4int copyNo = touchable->GetVolume()->GetCopyNo();
-                fHitsMap->add(copyNo, photonEnergy);
+                fHitsMap->add(copyNo, photonEnergy * aStep->GetPreStepPoint()->GetWeight());
             }
         }
     }
@@ -363,7 +365,8 @@ SCLightScorer::~SCLightScorer() {}
 G4bool SCLightScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
     G4Track* aTrack = aStep->GetTrack();
     // 确保只处理光子并且产生过程是闪烁
-    if (aTrack->GetDefinition() == G4OpticalPhoton::Definition() &&
+    // 光学光子源产生的初级光子没有产生过程
+    if (aTrack->GetDefinition() == G4OpticalPhoton::Definition() && aTrack->GetCreatorProcess() &&
         aTrack->GetCreatorProcess()->GetProcessName() == "Scintillation") {
         G4int trackID = aTrack->GetTrackID();
         // 检查光子是否已经处理过
@@ -371,7 +374,7 @@ G4bool SCLightScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
             G4double energy = aTrack->GetTotalEnergy();
             G4double wavelength = (1239.841939 * nm) / energy;  // 将能量转换为波长
             auto analysisManager = G4AnalysisManager::Instance();
-            analysisManager->FillH1(fHistogramId, wavelength);
+            analysisManager->FillH1(fHistogramId, wavelength, aTrack->GetWeight());
             // 标记光子为已处理
             processedTrackIDs.insert(trackID);
         }
@@ -396,7 +399,8 @@ CherenkovLightScorer::~CherenkovLightScorer() {}
 G4bool CherenkovLightScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
     G4Track* aTrack = aStep->GetTrack();
     // 确保只处理光子并且是切伦科夫光子
-    if (aTrack->GetDefinition() == G4OpticalPhoton::Definition() &&
+    // 光学光子源产生的初级光子没有产生过程
+    if (aTrack->GetDefinition() == G4OpticalPhoton::Definition() && aTrack->GetCreatorProcess() &&
         aTrack->GetCreatorProcess()->GetProcessName() == "Cerenkov") {
         G4int trackID = aTrack->GetTrackID();
         // 检查光子是否已经处理过
@@ -404,7 +408,7 @@ G4bool CherenkovLightScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
             G4double energy = aTrack->GetTotalEnergy();
             G4double wavelength = (1239.841939 * nm) / energy;  // 将能量转换为波长
             auto analysisManager = G4AnalysisManager::Instance();
-            analysisManager->FillH1(fHistogramId, wavelength);
+            analysisManager->FillH1(fHistogramId, wavelength, aTrack->GetWeight());
             // 标记光子为已处理
             processedTrackIDs.insert(trackID);
         }
@@ -464,7 +468,7 @@ G4bool FiberAcceptanceScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
             // G4cout << "Photon ID: " << trackID << " is accepted" << G4endl;
 
                 auto analysisManager = G4AnalysisManager::Instance();
-                analysisManager->FillH1(fHistogramId, wavelength);
+                analysisManager->FillH1(fHistogramId, wavelength, aTrack->GetWeight());
                 // 标记光子为已处理
                 processedTrackIDs.insert(trackID);
             }
@@ -502,7 +506,7 @@ G4bool FiberEntryPhotonScorer::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
 
             // 记录进入光纤的光谱
             auto analysisManager = G4AnalysisManager::Instance();
-            analysisManager->FillH1(fHistogramId, wavelength);
+            analysisManager->FillH1(fHistogramId, wavelength, aTrack->GetWeight());
             // 标记光子为已处理
             processedTrackIDs.insert(trackID);
         }
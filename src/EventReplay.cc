@@ -0,0 +1,98 @@
+#include "EventReplay.hh"
+#include "EventSeeder.hh"
+#include "EventWatchdog.hh"
+#include "utilities.hh"
+
+#include "G4Exception.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4RunManager.hh"
+#include "G4Step.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Track.hh"
+#include "G4UImanager.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VProcess.hh"
+
+G4bool EventReplay::fActive = false;
+G4int EventReplay::fRunID = 0;
+G4int EventReplay::fEventID = 0;
+std::mutex EventReplay::fMutex;
+std::ofstream EventReplay::fPhotonFile;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void EventReplay::Replay(G4int runID, G4int eventID, G4int trackingVerbose, const G4String& photonFile)
+{
+  if (runID < 0 || eventID < 0) {
+    G4ExceptionDescription ed;
+    ed << "Invalid replay target run " << runID << " event " << eventID;
+    G4Exception("EventReplay::Replay", "InvalidReplayEvent", JustWarning, ed);
+    return;
+  }
+
+  if (!photonFile.empty()) {
+    fPhotonFile.open(photonFile, std::ios::out | std::ios::trunc);
+    if (!fPhotonFile.is_open()) {
+      G4ExceptionDescription ed;
+      ed << "Cannot write photon dump " << photonFile;
+      G4Exception("EventReplay::Replay", "FileNotWritable", JustWarning, ed);
+    }
+    else {
+      fPhotonFile << "track,parent,creator,x0_mm,y0_mm,z0_mm,x1_mm,y1_mm,z1_mm,energy_eV,"
+                     "steps,length_mm,end_volume,end_process\n";
+    }
+  }
+
+  EventSeeder::Seeds seeds = EventSeeder::Derive(runID, eventID);
+  myPrint(INFO, f("Replaying run %d event %d (run seed %llu, engine seeds %ld %ld)", runID, eventID,
+                  static_cast<unsigned long long>(EventSeeder::GetRunSeed()), seeds.engine[0], seeds.engine[1]));
+
+  // /tracking/verbose在下一个run开始时广播到工作线程
+  G4UImanager* ui = G4UImanager::GetUIpointer();
+  if (trackingVerbose > 0) ui->ApplyCommand("/tracking/verbose " + std::to_string(trackingVerbose));
+
+  // 重放的常常是超出预算被中止的事件，重放时不限制时间和步数
+  G4double timeLimit = EventWatchdog::GetTimeLimit();
+  G4long stepLimit = EventWatchdog::GetStepLimit();
+  EventWatchdog::SetTimeLimit(0.);
+  EventWatchdog::SetStepLimit(0);
+
+  fRunID = runID;
+  fEventID = eventID;
+  fActive = true;
+  G4RunManager::GetRunManager()->BeamOn(1);
+  fActive = false;
+
+  EventWatchdog::SetTimeLimit(timeLimit);
+  EventWatchdog::SetStepLimit(stepLimit);
+
+  if (trackingVerbose > 0) ui->ApplyCommand("/tracking/verbose 0");
+  if (fPhotonFile.is_open()) {
+    fPhotonFile.close();
+    myPrint(INFO, fmt("Optical photon tracks of the replayed event written to {}", photonFile));
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void EventReplay::DumpPhoton(const G4Track* track)
+{
+  if (!fActive || !fPhotonFile.is_open()) return;
+  if (track->GetParticleDefinition() != G4OpticalPhoton::Definition()) return;
+
+  const G4ThreeVector& start = track->GetVertexPosition();
+  const G4ThreeVector& end = track->GetPosition();
+  const G4VProcess* creator = track->GetCreatorProcess();
+  const G4VPhysicalVolume* volume = track->GetVolume();
+  const G4VProcess* endProcess = track->GetStep() ? track->GetStep()->GetPostStepPoint()->GetProcessDefinedStep() : nullptr;
+
+  std::lock_guard<std::mutex> lock(fMutex);
+  fPhotonFile << track->GetTrackID() << "," << track->GetParentID() << ","
+              << (creator ? creator->GetProcessName() : G4String("primary")) << ","
+              << start.x() / mm << "," << start.y() / mm << "," << start.z() / mm << ","
+              << end.x() / mm << "," << end.y() / mm << "," << end.z() / mm << ","
+              << track->GetVertexKineticEnergy() / eV << ","
+              << track->GetCurrentStepNumber() << "," << track->GetTrackLength() / mm << ","
+              << (volume ? volume->GetName() : G4String("OutOfWorld")) << ","
+              << (endProcess ? endProcess->GetProcessName() : G4String("none")) << "\n";
+}
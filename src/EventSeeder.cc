@@ -0,0 +1,83 @@
+#include "EventSeeder.hh"
+
+#include "Randomize.hh"
+
+#include <cctype>
+#include <ctime>
+#include <stdexcept>
+
+std::uint64_t EventSeeder::fRunSeed = static_cast<std::uint64_t>(std::time(nullptr));
+
+namespace
+{
+  // SplitMix64：相邻输入的输出互不相关，用于从run种子派生事件种子
+  std::uint64_t SplitMix64(std::uint64_t& state)
+  {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  // CLHEP各引擎的setSeeds只使用种子的低32位，且种子为0表示数组结束
+  long EngineSeed(std::uint64_t& state)
+  {
+    long seed = 0;
+    while (seed == 0) seed = static_cast<long>(SplitMix64(state) & 0x7FFFFFFF);
+    return seed;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool EventSeeder::ParseSeed(const G4String& text, std::uint64_t& seed)
+{
+  // 只接受十进制和0x开头的十六进制，前导0不按八进制解释；stoull接受的符号和空白不允许
+  G4bool hex = text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X');
+  std::string digits = hex ? text.substr(2) : std::string(text);
+  if (digits.empty() || !(hex ? std::isxdigit(static_cast<unsigned char>(digits[0]))
+                              : std::isdigit(static_cast<unsigned char>(digits[0])))) return false;
+  try {
+    size_t pos = 0;
+    seed = std::stoull(digits, &pos, hex ? 16 : 10);
+    return pos == digits.size();
+  }
+  catch (const std::exception&) {
+    return false;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+EventSeeder::Seeds EventSeeder::Derive(G4int runID, G4int eventID)
+{
+  std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(runID)) << 32) |
+                      static_cast<std::uint32_t>(eventID);
+  std::uint64_t state = fRunSeed ^ SplitMix64(key);
+
+  Seeds seeds;
+  seeds.engine[0] = EngineSeed(state);
+  seeds.engine[1] = EngineSeed(state);
+  seeds.aux = SplitMix64(state);
+  return seeds;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+EventSeeder::Seeds EventSeeder::SeedEvent(G4int runID, G4int eventID)
+{
+  Seeds seeds = Derive(runID, eventID);
+  long engineSeeds[3] = {seeds.engine[0], seeds.engine[1], 0};
+  G4Random::setTheSeeds(engineSeeds, -1);
+  return seeds;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void EventSeeder::SeedBatch(std::uint64_t eventSeed, G4int batch)
+{
+  std::uint64_t key = static_cast<std::uint32_t>(batch);
+  std::uint64_t state = eventSeed ^ SplitMix64(key);
+  long engineSeeds[3] = {EngineSeed(state), EngineSeed(state), 0};
+  G4Random::setTheSeeds(engineSeeds, -1);
+}
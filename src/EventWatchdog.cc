@@ -0,0 +1,64 @@
+#include "EventWatchdog.hh"
+#include "MyEventInfo.hh"
+#include "StartupBenchmark.hh"
+#include "utilities.hh"
+
+#include "G4Event.hh"
+#include "G4EventManager.hh"
+
+const char* EventWatchdog::kAbortTime = "time";
+const char* EventWatchdog::kAbortSteps = "steps";
+const char* EventWatchdog::kAbortOther = "aborted";
+
+G4double EventWatchdog::fTimeLimit = 0.;
+G4long EventWatchdog::fStepLimit = 0;
+G4ThreadLocal G4double EventWatchdog::fEventStart = 0.;
+G4ThreadLocal G4long EventWatchdog::fSteps = 0;
+G4ThreadLocal G4bool EventWatchdog::fAborted = false;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void EventWatchdog::BeginEvent()
+{
+  fEventStart = StartupBenchmark::Elapsed();
+  fSteps = 0;
+  fAborted = false;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void EventWatchdog::CheckStep()
+{
+  // 中止请求发出后，当前径迹和堆栈中剩余的径迹不再需要检查
+  if (fAborted) return;
+
+  fSteps++;
+  if (fStepLimit > 0 && fSteps > fStepLimit) {
+    Abort(kAbortSteps);
+    return;
+  }
+  if (fTimeLimit > 0. && fSteps % kTimeCheckInterval == 0 &&
+      StartupBenchmark::Elapsed() - fEventStart > fTimeLimit) {
+    Abort(kAbortTime);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void EventWatchdog::Abort(const char* reason)
+{
+  fAborted = true;
+
+  // 为其他线程处理光子批的事件不是G4RunManager的当前事件，通过G4EventManager中止
+  G4EventManager* eventManager = G4EventManager::GetEventManager();
+  G4Event* event = eventManager->GetNonconstCurrentEvent();
+  if (event == nullptr) return;
+  if (auto eventInfo = dynamic_cast<MyEventInfo*>(event->GetUserInformation())) {
+    eventInfo->SetAbortReason(reason);
+  }
+  myPrint(INFO, f("Event %d aborted after %ld steps and %.1f s (%s budget exceeded)", event->GetEventID(),
+                  fSteps, StartupBenchmark::Elapsed() - fEventStart, reason));
+
+  event->SetEventAborted();
+  eventManager->AbortCurrentEvent();
+}
@@ -0,0 +1,176 @@
+#include "GeometryValidator.hh"
+#include "utilities.hh"
+
+#include "G4Exception.hh"
+#include "G4LogicalVolume.hh"
+#include "G4RunManager.hh"
+#include "G4Threading.hh"
+#include "G4Timer.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  // 每个物理体表面采样的点数（Geant4默认值）
+  const G4int kOverlapResolution = 1000;
+
+  // 第i个物理体检查前以 kOverlapSeed + i 设定随机数种子，取点与线程调度无关，检查结果可重复
+  const long kOverlapSeed = 20240601;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void GeometryValidator::Check(G4VPhysicalVolume* world, const G4String& geometryFile,
+                              const G4String& config, const G4String& mode)
+{
+  if (mode == "off") {
+    myPrint(INFO, "Overlap check disabled");
+    return;
+  }
+
+  G4String cacheFile = geometryFile + ".overlaps";
+  std::uint64_t hash = Hash(geometryFile, config);
+  std::uint64_t cachedHash = 0;
+  G4bool cachedPassed = false;
+  G4bool cacheValid = ReadCache(cacheFile, cachedHash, cachedPassed) && cachedHash == hash;
+
+  if (mode != "validate" && cacheValid) {
+    if (!cachedPassed) {
+      G4ExceptionDescription ed;
+      ed << "Geometry " << f("%016llx", static_cast<unsigned long long>(hash))
+         << " failed the overlap check recorded in " << cacheFile << ", fix the geometry first";
+      G4Exception("GeometryValidator::Check", "GeometryOverlaps", FatalException, ed);
+      return;
+    }
+    myPrint(INFO, f("Overlap check skipped, geometry %016llx passed before (%s)",
+                    static_cast<unsigned long long>(hash), cacheFile.c_str()));
+    return;
+  }
+
+  if (mode == "require") {
+    G4ExceptionDescription ed;
+    ed << "Geometry " << f("%016llx", static_cast<unsigned long long>(hash))
+       << " has not been validated (" << cacheFile << " missing or stale)." << G4endl
+       << "Run once with /CompScintSim/DetectorConstruction/overlapCheck validate";
+    G4Exception("GeometryValidator::Check", "GeometryNotValidated", FatalException, ed);
+    return;
+  }
+
+  G4int nVolumes = 0;
+  G4int nOverlaps = RunOverlapCheck(world, nVolumes);
+  WriteCache(cacheFile, hash, nOverlaps == 0, nVolumes);
+
+  if (nOverlaps > 0) {
+    G4ExceptionDescription ed;
+    ed << nOverlaps << " of " << nVolumes << " volumes overlap, see the warnings above";
+    G4Exception("GeometryValidator::Check", "GeometryOverlaps", FatalException, ed);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int GeometryValidator::RunOverlapCheck(G4VPhysicalVolume* world, G4int& nVolumes)
+{
+  // 收集所有放置的物理体，共用逻辑体的子体积只检查一次；
+  // G4PVReplica的各份互不重叠，不需要检查，但要继续检查其中的子体积
+  std::vector<G4VPhysicalVolume*> volumes;
+  std::set<const G4LogicalVolume*> visited;
+  std::vector<G4LogicalVolume*> pending(1, world->GetLogicalVolume());
+  visited.insert(world->GetLogicalVolume());
+  while (!pending.empty()) {
+    G4LogicalVolume* logical = pending.back();
+    pending.pop_back();
+    for (size_t i = 0; i < logical->GetNoDaughters(); i++) {
+      G4VPhysicalVolume* daughter = logical->GetDaughter(i);
+      if (!daughter->IsReplicated()) volumes.push_back(daughter);
+      if (visited.insert(daughter->GetLogicalVolume()).second) {
+        pending.push_back(daughter->GetLogicalVolume());
+      }
+    }
+  }
+  nVolumes = volumes.size();
+
+  // CheckOverlaps在物理体、母体和姊妹体的表面上取点。布尔实体等在第一次调用GetPointOnSurface时
+  // 才建立基本体列表和面积缓存，并发的第一次调用会同时写这些缓存，因此先在本线程逐个取一次点
+  std::set<G4VSolid*> solids;
+  for (const G4LogicalVolume* logical : visited) solids.insert(logical->GetSolid());
+  for (G4VSolid* solid : solids) solid->GetPointOnSurface();
+
+  // 线程数不超过运行配置的线程数（-t），顺序模式下为1
+  G4int nThreads = std::min<G4int>(G4RunManager::GetRunManager()->GetNumberOfThreads(), G4Threading::G4GetNumberOfCores());
+  nThreads = std::max(1, std::min<G4int>(nThreads, nVolumes));
+  G4Timer timer;
+  timer.Start();
+
+  // 各线程从共享的索引依次取物理体检查，重叠由CheckOverlaps以警告形式输出。
+  // 新建的线程使用线程局部的随机数引擎，每个物理体检查前重新设定种子，不影响主线程的随机数序列
+  std::atomic<size_t> next(0);
+  std::atomic<G4int> nOverlaps(0);
+  auto worker = [&]() {
+    for (size_t i = next++; i < volumes.size(); i = next++) {
+      G4Random::setTheSeed(kOverlapSeed + static_cast<long>(i));
+      if (volumes[i]->CheckOverlaps(kOverlapResolution, 0., false, 1)) nOverlaps++;
+    }
+  };
+  std::vector<std::thread> threads;
+  for (G4int i = 0; i < nThreads; i++) threads.emplace_back(worker);
+  for (auto& thread : threads) thread.join();
+
+  timer.Stop();
+  myPrint(INFO, f("Overlap check of %d volumes on %d threads: %d overlapping, %.2f s",
+                  nVolumes, nThreads, nOverlaps.load(), timer.GetRealElapsed()));
+  return nOverlaps;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+std::uint64_t GeometryValidator::Hash(const G4String& geometryFile, const G4String& config)
+{
+  std::ifstream file(geometryFile, std::ios::binary);
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return HashBytes(config, HashBytes(content));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool GeometryValidator::ReadCache(const G4String& cacheFile, std::uint64_t& hash, G4bool& passed)
+{
+  std::ifstream file(cacheFile);
+  if (!file) return false;
+
+  std::string key, hashStr, result;
+  if (!(file >> key >> hashStr) || key != "hash") return false;
+  if (!(file >> key >> result) || key != "result") return false;
+  try {
+    hash = std::stoull(hashStr, nullptr, 16);
+  }
+  catch (const std::exception&) {
+    return false;
+  }
+  passed = (result == "pass");
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void GeometryValidator::WriteCache(const G4String& cacheFile, std::uint64_t hash, G4bool passed, G4int nVolumes)
+{
+  std::ofstream file(cacheFile);
+  if (!file) {
+    myPrint(ERROR, fmt("Cannot write overlap check cache {}", cacheFile));
+    return;
+  }
+  file << "hash " << f("%016llx", static_cast<unsigned long long>(hash)) << "\n"
+       << "result " << (passed ? "pass" : "fail") << "\n"
+       << "volumes " << nVolumes << "\n";
+}
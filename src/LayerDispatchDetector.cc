@@ -0,0 +1,20 @@
+#include "LayerDispatchDetector.hh"
+#include "ScintillatorLayerManager.hh"
+
+#include "G4Step.hh"
+
+LayerDispatchDetector::LayerDispatchDetector(const G4String& name)
+    : G4VSensitiveDetector(name) {}
+
+void LayerDispatchDetector::AddLayer(G4int copynumber, G4VSensitiveDetector* detector) {
+    fDetectors[copynumber] = detector;
+}
+
+G4bool LayerDispatchDetector::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
+    G4int copynumber = ScintillatorLayerManager::GetInstance().GetLayerCopynumber(
+        aStep->GetPreStepPoint()->GetTouchable());
+    auto it = fDetectors.find(copynumber);
+    if (it == fDetectors.end()) return false;
+    // Hit()会检查该层探测器的激活状态和过滤器
+    return it->second->Hit(aStep);
+}
@@ -0,0 +1,577 @@
+#include "MaterialDatabase.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "G4Element.hh"
+#include "G4Exception.hh"
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4NistManager.hh"
+#include "G4SystemOfUnits.hh"
+
+#include "MaterialManager.hh"
+#include "MyMaterials.hh"
+#include "config.hh"
+#include "utilities.hh"
+
+namespace {
+    const char kMaterialDBMagic[8] = {'C', 'S', 'S', 'M', 'A', 'T', 'D', 'B'};
+    const uint32_t kMaterialDBVersion = 1;
+
+    // 文本源解析后的条目
+    struct Property {
+        MaterialDBProperty header;
+        std::vector<double> energy;
+        std::vector<double> value;
+    };
+
+    struct Entry {
+        MaterialDBRecord record;
+        std::vector<MaterialDBComponent> components;
+        std::vector<MaterialDBConst> consts;
+        std::vector<Property> properties;
+    };
+
+    // 按空白分词，跳过#后的注释，并记录每个词所在的行号
+    class Tokenizer {
+    public:
+        Tokenizer(std::istream& in, const G4String& fileName) : fFileName(fileName), fPos(0)
+        {
+            std::string line;
+            G4int lineNumber = 0;
+            while (std::getline(in, line)) {
+                lineNumber++;
+                size_t comment = line.find('#');
+                if (comment != std::string::npos) line.erase(comment);
+                std::istringstream words(line);
+                std::string word;
+                while (words >> word) {
+                    fTokens.push_back(word);
+                    fLines.push_back(lineNumber);
+                }
+            }
+        }
+
+        G4bool AtEnd() const { return fPos >= fTokens.size(); }
+
+        const std::string& Peek() const
+        {
+            if (AtEnd()) Error("unexpected end of file");
+            return fTokens[fPos];
+        }
+
+        std::string Next()
+        {
+            if (AtEnd()) Error("unexpected end of file");
+            return fTokens[fPos++];
+        }
+
+        double NextDouble()
+        {
+            std::string word = Next();
+            char* end = nullptr;
+            double value = std::strtod(word.c_str(), &end);
+            if (end == word.c_str() || *end != '\0') Error("expected a number, got '" + word + "'");
+            return value;
+        }
+
+        void Error(const std::string& message) const
+        {
+            G4ExceptionDescription ed;
+            ed << fFileName << ":" << (fPos > 0 ? fLines[fPos - 1] : 0) << ": " << message;
+            G4Exception("MaterialDatabase::Compile", "InvalidMaterialDatabase", FatalException, ed);
+        }
+
+    private:
+        G4String fFileName;
+        std::vector<std::string> fTokens;
+        std::vector<G4int> fLines;
+        size_t fPos;
+    };
+
+    void CopyName(char* dest, size_t size, const std::string& name, const Tokenizer& tokens)
+    {
+        if (name.size() >= size) tokens.Error("name too long: " + name);
+        std::memset(dest, 0, size);
+        std::memcpy(dest, name.data(), name.size());
+    }
+
+    G4int ParseState(const std::string& state, const Tokenizer& tokens)
+    {
+        if (state == "solid") return kStateSolid;
+        if (state == "liquid") return kStateLiquid;
+        if (state == "gas") return kStateGas;
+        tokens.Error("unknown state: " + state);
+        return kStateUndefined;
+    }
+
+    G4int ParseAmountType(const std::string& type, const Tokenizer& tokens)
+    {
+        if (type == "atoms") return 1;
+        if (type == "fraction") return 0;
+        tokens.Error("expected 'atoms' or 'fraction', got '" + type + "'");
+        return 0;
+    }
+
+    Entry ParseMaterial(Tokenizer& tokens, const std::string& name)
+    {
+        Entry entry;
+        std::memset(&entry.record, 0, sizeof(entry.record));
+        entry.record.kind = MaterialDatabase::kCompound;
+        entry.record.state = kStateUndefined;
+        CopyName(entry.record.g4name, sizeof(entry.record.g4name), name, tokens);
+
+        while (true) {
+            std::string keyword = tokens.Next();
+            if (keyword == "end") break;
+
+            if (keyword == "name") {
+                CopyName(entry.record.g4name, sizeof(entry.record.g4name), tokens.Next(), tokens);
+            }
+            else if (keyword == "nist") {
+                std::string nistName = tokens.Next();
+                entry.record.kind = MaterialDatabase::kNist;
+                CopyName(entry.record.target, sizeof(entry.record.target), nistName, tokens);
+                CopyName(entry.record.g4name, sizeof(entry.record.g4name), nistName, tokens);
+            }
+            else if (keyword == "density") {
+                entry.record.density = tokens.NextDouble() * g / cm3;
+            }
+            else if (keyword == "state") {
+                entry.record.state = ParseState(tokens.Next(), tokens);
+            }
+            else if (keyword == "element") {
+                MaterialDBComponent component;
+                std::memset(&component, 0, sizeof(component));
+                component.kind = MaterialDatabase::kElement;
+                CopyName(component.name, sizeof(component.name), tokens.Next(), tokens);
+                component.byAtoms = ParseAmountType(tokens.Next(), tokens);
+                component.amount = tokens.NextDouble();
+                entry.components.push_back(component);
+            }
+            else if (keyword == "customElement") {
+                MaterialDBComponent component;
+                std::memset(&component, 0, sizeof(component));
+                component.kind = MaterialDatabase::kCustomElement;
+                CopyName(component.name, sizeof(component.name), tokens.Next(), tokens);
+                CopyName(component.symbol, sizeof(component.symbol), tokens.Next(), tokens);
+                component.Z = tokens.NextDouble();
+                component.A = tokens.NextDouble() * g / mole;
+                component.byAtoms = ParseAmountType(tokens.Next(), tokens);
+                component.amount = tokens.NextDouble();
+                entry.components.push_back(component);
+            }
+            else if (keyword == "component") {
+                MaterialDBComponent component;
+                std::memset(&component, 0, sizeof(component));
+                component.kind = MaterialDatabase::kSubMaterial;
+                CopyName(component.name, sizeof(component.name), tokens.Next(), tokens);
+                component.amount = tokens.NextDouble();
+                entry.components.push_back(component);
+            }
+            else if (keyword == "scintillator") {
+                entry.record.flags |= MaterialDatabase::kScintillator;
+            }
+            else if (keyword == "birks") {
+                entry.record.flags |= MaterialDatabase::kHasBirks;
+                entry.record.birks = tokens.NextDouble() * mm / MeV;
+            }
+            else if (keyword == "const") {
+                MaterialDBConst constant;
+                CopyName(constant.key, sizeof(constant.key), tokens.Next(), tokens);
+                constant.value = tokens.NextDouble();
+                entry.consts.push_back(constant);
+            }
+            else if (keyword == "property") {
+                Property property;
+                std::memset(&property.header, 0, sizeof(property.header));
+                CopyName(property.header.key, sizeof(property.header.key), tokens.Next(), tokens);
+                double n = tokens.NextDouble();
+                if (n < 1 || n != static_cast<uint32_t>(n)) tokens.Error("invalid number of entries");
+                property.header.nEntries = static_cast<uint32_t>(n);
+                // 数据之前可以带缩放标记
+                while (tokens.Peek() == "attenuation" || tokens.Peek() == "yield") {
+                    property.header.flags |= (tokens.Next() == "attenuation") ? MaterialDatabase::kScaleWithAttenuation
+                                                                              : MaterialDatabase::kScaleWithYield;
+                }
+                for (uint32_t i = 0; i < property.header.nEntries; i++) {
+                    property.energy.push_back(tokens.NextDouble() * eV);
+                    property.value.push_back(tokens.NextDouble());
+                }
+                entry.properties.push_back(property);
+            }
+            else {
+                tokens.Error("unknown keyword: " + keyword);
+            }
+        }
+
+        if (entry.record.kind == MaterialDatabase::kCompound
+            && (entry.components.empty() || entry.record.density <= 0)) {
+            tokens.Error("material " + name + " needs a density and at least one component");
+        }
+        entry.record.nComponents = entry.components.size();
+        entry.record.nConsts = entry.consts.size();
+        entry.record.nProperties = entry.properties.size();
+        return entry;
+    }
+
+    // 非空结尾的定长名称转为字符串
+    G4String FixedName(const char* name, size_t size)
+    {
+        return G4String(name, strnlen(name, size));
+    }
+
+    G4bool FileTime(const G4String& fileName, time_t& mtime)
+    {
+        struct stat st;
+        if (stat(fileName.c_str(), &st) != 0) return false;
+        mtime = st.st_mtime;
+        return true;
+    }
+}
+
+MaterialDatabase& MaterialDatabase::Instance()
+{
+    static MaterialDatabase instance;
+    return instance;
+}
+
+MaterialDatabase::MaterialDatabase()
+    : fFileName(g_material_database), fOpened(false),
+      fData(nullptr), fSize(0), fHeader(nullptr), fIndex(nullptr)
+{
+    // 环境变量优先于默认值，便于在不修改宏的情况下切换数据库
+    if (const char* env = std::getenv("COMPSCINTSIM_MATERIAL_DB")) {
+        fFileName = env;
+    }
+}
+
+MaterialDatabase::~MaterialDatabase()
+{
+    if (fData) {
+        munmap(fData, fSize);
+    }
+}
+
+void MaterialDatabase::SetFileName(const G4String& fileName)
+{
+    std::lock_guard<std::mutex> lock(fOpenMutex);
+    if (fOpened) {
+        G4ExceptionDescription ed;
+        ed << "Material database " << fFileName << " is already in use, " << fileName << " is ignored";
+        G4Exception("MaterialDatabase::SetFileName", "CompScintSim_004", JustWarning, ed);
+        return;
+    }
+    fFileName = fileName;
+}
+
+void MaterialDatabase::Open()
+{
+    std::lock_guard<std::mutex> lock(fOpenMutex);
+    if (fOpened) return;
+
+    // 给出文本源时使用同名的.matdb，文本比二进制新时重新编译
+    G4String binaryFile = fFileName;
+    size_t extPos = fFileName.rfind(".");
+    if (extPos == std::string::npos || fFileName.substr(extPos) != ".matdb") {
+        binaryFile = (extPos != std::string::npos ? fFileName.substr(0, extPos) : fFileName) + ".matdb";
+        time_t textTime, binaryTime;
+        if (FileTime(fFileName, textTime)
+            && (!FileTime(binaryFile, binaryTime) || binaryTime < textTime)) {
+            Compile(fFileName, binaryFile);
+        }
+    }
+
+    Map(binaryFile);
+    fOpened = true;
+}
+
+void MaterialDatabase::Map(const G4String& binaryFile)
+{
+    int fd = open(binaryFile.c_str(), O_RDONLY);
+    if (fd < 0) {
+        G4ExceptionDescription ed;
+        ed << "Cannot open material database: " << binaryFile
+           << " (set /CompScintSim/DetectorConstruction/materialDatabase or COMPSCINTSIM_MATERIAL_DB)";
+        G4Exception("MaterialDatabase::Map", "FileNotFound", FatalException, ed);
+        return;
+    }
+
+    struct stat st;
+    fstat(fd, &st);
+    fSize = st.st_size;
+    if (fSize >= sizeof(MaterialDBHeader)) {
+        fData = mmap(nullptr, fSize, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if (fData == nullptr || fData == MAP_FAILED) {
+        fData = nullptr;
+        G4ExceptionDescription ed;
+        ed << "Cannot map material database: " << binaryFile;
+        G4Exception("MaterialDatabase::Map", "InvalidMaterialDatabase", FatalException, ed);
+        return;
+    }
+
+    fHeader = static_cast<const MaterialDBHeader*>(fData);
+    if (std::memcmp(fHeader->magic, kMaterialDBMagic, sizeof(kMaterialDBMagic)) != 0
+        || fHeader->version != kMaterialDBVersion
+        || fHeader->fileSize != fSize
+        || sizeof(MaterialDBHeader) + fHeader->nEntries * sizeof(MaterialDBIndex) > fSize) {
+        G4ExceptionDescription ed;
+        ed << "Invalid material database: " << binaryFile << ", delete it to rebuild from the text source";
+        G4Exception("MaterialDatabase::Map", "InvalidMaterialDatabase", FatalException, ed);
+        return;
+    }
+    fIndex = reinterpret_cast<const MaterialDBIndex*>(static_cast<const char*>(fData) + sizeof(MaterialDBHeader));
+
+    // 只按需读取个别条目
+    madvise(fData, fSize, MADV_RANDOM);
+
+    myPrint(INFO, fmt("Material database mapped: {} ({} entries)", binaryFile, fHeader->nEntries));
+}
+
+const MaterialDBRecord* MaterialDatabase::FindRecord(const G4String& name)
+{
+    Open();
+    const MaterialDBIndex* end = fIndex + fHeader->nEntries;
+    const MaterialDBIndex* it = std::lower_bound(fIndex, end, name,
+        [](const MaterialDBIndex& index, const G4String& key) {
+            return std::strncmp(index.name, key.c_str(), sizeof(index.name)) < 0;
+        });
+    if (it == end || FixedName(it->name, sizeof(it->name)) != name) return nullptr;
+    return reinterpret_cast<const MaterialDBRecord*>(static_cast<const char*>(fData) + it->offset);
+}
+
+G4String MaterialDatabase::ResolveName(const G4String& name)
+{
+    const MaterialDBRecord* record = FindRecord(name);
+    if (record && record->kind == kAlias) {
+        return FixedName(record->target, sizeof(record->target));
+    }
+    return name;
+}
+
+G4bool MaterialDatabase::HasMaterial(const G4String& name)
+{
+    return FindRecord(ResolveName(name)) != nullptr;
+}
+
+G4bool MaterialDatabase::IsScintillator(const G4String& name)
+{
+    const MaterialDBRecord* record = FindRecord(ResolveName(name));
+    return record && (record->flags & kScintillator);
+}
+
+std::vector<G4String> MaterialDatabase::GetMaterialNames(G4bool scintillators)
+{
+    Open();
+    std::vector<G4String> names;
+    for (uint32_t i = 0; i < fHeader->nEntries; i++) {
+        G4String name = FixedName(fIndex[i].name, sizeof(fIndex[i].name));
+        if (IsScintillator(name) == scintillators) {
+            names.push_back(name);
+        }
+    }
+    return names;
+}
+
+G4Material* MaterialDatabase::BuildMaterial(const G4String& name, G4double lightYield,
+                                            G4double attenuationScale, G4double birks)
+{
+    const MaterialDBRecord* record = FindRecord(ResolveName(name));
+    if (!record) return nullptr;
+
+    const char* cursor = reinterpret_cast<const char*>(record + 1);
+    const MaterialDBComponent* components = reinterpret_cast<const MaterialDBComponent*>(cursor);
+    cursor += record->nComponents * sizeof(MaterialDBComponent);
+    const MaterialDBConst* consts = reinterpret_cast<const MaterialDBConst*>(cursor);
+    cursor += record->nConsts * sizeof(MaterialDBConst);
+
+    G4Material* mat = nullptr;
+    if (record->kind == kNist) {
+        mat = G4NistManager::Instance()->FindOrBuildMaterial(FixedName(record->target, sizeof(record->target)));
+    }
+    else {
+        mat = new G4Material(FixedName(record->g4name, sizeof(record->g4name)), record->density,
+                             static_cast<G4int>(record->nComponents), static_cast<G4State>(record->state));
+        for (uint32_t i = 0; i < record->nComponents; i++) {
+            const MaterialDBComponent& component = components[i];
+            G4String componentName = FixedName(component.name, sizeof(component.name));
+            if (component.kind == kSubMaterial) {
+                G4Material* subMaterial = MaterialManager::GetMaterial(componentName);
+                if (!subMaterial) {
+                    G4ExceptionDescription ed;
+                    ed << "Material " << name << " uses unknown material " << componentName;
+                    G4Exception("MaterialDatabase::BuildMaterial", "InvalidMaterialDatabase", FatalException, ed);
+                }
+                mat->AddMaterial(subMaterial, component.amount);
+                continue;
+            }
+
+            G4Element* element = nullptr;
+            if (component.kind == kCustomElement) {
+                // 没有对应NIST元素的自定义元素，全局只创建一次
+                element = G4Element::GetElement(componentName, false);
+                if (!element) {
+                    element = new G4Element(componentName, FixedName(component.symbol, sizeof(component.symbol)),
+                                            component.Z, component.A);
+                }
+            }
+            else {
+                element = MyMaterials::GetElement(componentName);
+            }
+            if (component.byAtoms) {
+                mat->AddElement(element, static_cast<G4int>(component.amount));
+            } else {
+                mat->AddElement(element, component.amount);
+            }
+        }
+    }
+
+    G4bool isScintillator = record->flags & kScintillator;
+    if (record->nConsts > 0 || record->nProperties > 0) {
+        // 闪烁体按用户给定的光产额替换默认值，按比例缩放与光产额相关的性质
+        G4double yieldScale = 1;
+        G4MaterialPropertiesTable* mpt = new G4MaterialPropertiesTable();
+        for (uint32_t i = 0; i < record->nConsts; i++) {
+            G4String key = FixedName(consts[i].key, sizeof(consts[i].key));
+            G4double value = consts[i].value;
+            if (isScintillator && key == "SCINTILLATIONYIELD" && lightYield != -1) {
+                if (value > 0) yieldScale = (lightYield / MeV) / value;
+                value = lightYield / MeV;
+            }
+            mpt->AddConstProperty(key, value, true);
+        }
+
+        for (uint32_t i = 0; i < record->nProperties; i++) {
+            const MaterialDBProperty* property = reinterpret_cast<const MaterialDBProperty*>(cursor);
+            const double* energy = reinterpret_cast<const double*>(property + 1);
+            const double* values = energy + property->nEntries;
+            cursor = reinterpret_cast<const char*>(values + property->nEntries);
+
+            std::vector<G4double> energyVector(energy, energy + property->nEntries);
+            std::vector<G4double> valueVector(values, values + property->nEntries);
+            G4double scale = 1;
+            if (property->flags & kScaleWithAttenuation) scale *= attenuationScale;
+            if (property->flags & kScaleWithYield) scale *= yieldScale;
+            if (scale != 1) {
+                for (auto& value : valueVector) {
+                    value *= scale;
+                }
+            }
+            mpt->AddProperty(FixedName(property->key, sizeof(property->key)), energyVector, valueVector, true);
+        }
+        mat->SetMaterialPropertiesTable(mpt);
+    }
+
+    if (isScintillator) {
+        mat->GetIonisation()->SetBirksConstant(birks >= 0 ? birks * mm / MeV
+                                               : ((record->flags & kHasBirks) ? record->birks : 0.));
+    }
+    else if (record->flags & kHasBirks) {
+        mat->GetIonisation()->SetBirksConstant(record->birks);
+    }
+
+    myPrint(DEBUG, fmt("Built material {} from the material database", mat->GetName()));
+    return mat;
+}
+
+void MaterialDatabase::Compile(const G4String& textFile, const G4String& binaryFile)
+{
+    std::ifstream in(textFile);
+    if (!in.is_open()) {
+        G4ExceptionDescription ed;
+        ed << "Cannot open material database source: " << textFile;
+        G4Exception("MaterialDatabase::Compile", "FileNotFound", FatalException, ed);
+        return;
+    }
+
+    Tokenizer tokens(in, textFile);
+    std::vector<std::pair<G4String, Entry>> entries;
+    while (!tokens.AtEnd()) {
+        std::string keyword = tokens.Next();
+        if (keyword == "material") {
+            std::string name = tokens.Next();
+            entries.emplace_back(name, ParseMaterial(tokens, name));
+        }
+        else if (keyword == "alias") {
+            std::string name = tokens.Next();
+            Entry entry;
+            std::memset(&entry.record, 0, sizeof(entry.record));
+            entry.record.kind = kAlias;
+            CopyName(entry.record.target, sizeof(entry.record.target), tokens.Next(), tokens);
+            entries.emplace_back(name, entry);
+        }
+        else {
+            tokens.Error("expected 'material' or 'alias', got '" + keyword + "'");
+        }
+    }
+
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (size_t i = 1; i < entries.size(); i++) {
+        if (entries[i].first == entries[i - 1].first) {
+            tokens.Error("duplicate material: " + entries[i].first);
+        }
+    }
+
+    // 先计算各条目的偏移，再依次写出
+    MaterialDBHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kMaterialDBMagic, sizeof(kMaterialDBMagic));
+    header.version = kMaterialDBVersion;
+    header.nEntries = entries.size();
+
+    std::vector<MaterialDBIndex> index(entries.size());
+    uint64_t offset = sizeof(MaterialDBHeader) + entries.size() * sizeof(MaterialDBIndex);
+    for (size_t i = 0; i < entries.size(); i++) {
+        const Entry& entry = entries[i].second;
+        CopyName(index[i].name, sizeof(index[i].name), entries[i].first, tokens);
+        index[i].offset = offset;
+        offset += sizeof(MaterialDBRecord) + entry.components.size() * sizeof(MaterialDBComponent)
+                  + entry.consts.size() * sizeof(MaterialDBConst);
+        for (const auto& property : entry.properties) {
+            offset += sizeof(MaterialDBProperty) + 2 * property.energy.size() * sizeof(double);
+        }
+    }
+    header.fileSize = offset;
+
+    // 先写临时文件再改名，避免其他进程读到写了一半的文件
+    G4String tmpFile = binaryFile + ".tmp" + std::to_string(getpid());
+    std::ofstream out(tmpFile, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        G4ExceptionDescription ed;
+        ed << "Cannot write material database: " << binaryFile;
+        G4Exception("MaterialDatabase::Compile", "FileNotWritable", FatalException, ed);
+        return;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(MaterialDBIndex));
+    for (const auto& item : entries) {
+        const Entry& entry = item.second;
+        out.write(reinterpret_cast<const char*>(&entry.record), sizeof(entry.record));
+        out.write(reinterpret_cast<const char*>(entry.components.data()),
+                  entry.components.size() * sizeof(MaterialDBComponent));
+        out.write(reinterpret_cast<const char*>(entry.consts.data()), entry.consts.size() * sizeof(MaterialDBConst));
+        for (const auto& property : entry.properties) {
+            out.write(reinterpret_cast<const char*>(&property.header), sizeof(property.header));
+            out.write(reinterpret_cast<const char*>(property.energy.data()), property.energy.size() * sizeof(double));
+            out.write(reinterpret_cast<const char*>(property.value.data()), property.value.size() * sizeof(double));
+        }
+    }
+    out.close();
+    std::rename(tmpFile.c_str(), binaryFile.c_str());
+
+    myPrint(INFO, fmt("Material database compiled: {} -> {} ({} entries)", textFile, binaryFile, entries.size()));
+}
@@ -1,89 +1,75 @@
 #include "MaterialManager.hh"
+#include "MaterialDatabase.hh"
+#include "OpticalTableResampler.hh"
+#include "utilities.hh"
+
+#include <chrono>
+
+namespace {
+    // 材料构建的累计耗时，数据库材料的子材料递归构建时只计最外层；均受cacheMutex保护
+    G4int buildDepth = 0;
+    G4double buildTime = 0.;
+
+    struct ScopedBuildTimer {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        ScopedBuildTimer() { buildDepth++; }
+        ~ScopedBuildTimer() {
+            if (--buildDepth == 0) {
+                buildTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            }
+        }
+    };
+}
 
 // 初始化静态成员变量
 std::map<G4String, std::function<G4Material*()>> MaterialManager::materialMap;
 std::map<G4String, std::function<G4Material*(G4double, G4double, G4double)>> MaterialManager::scintillatorMap;
-bool MaterialManager::mapsInitialized = false;
+std::once_flag MaterialManager::mapsInitialized;
+std::map<G4String, G4Material*> MaterialManager::materialCache;
+std::map<MaterialManager::ScintillatorKey, G4Material*> MaterialManager::scintillatorCache;
+std::recursive_mutex MaterialManager::cacheMutex;
 
 // 初始化材料映射方法
 void MaterialManager::InitializeMaterialMaps() {
-    if (mapsInitialized) return;
-    
-    // 普通材料映射
-    materialMap["Boron"] = []() { return MyMaterials::Boron(); };
-    materialMap["TantalumFoil"] = []() { return MyMaterials::TantalumFoil(); };
-    materialMap["Graphite"] = []() { return MyMaterials::Graphite(); };
-    materialMap["PEEK"] = []() { return MyMaterials::PEEK(); };
+  std::call_once(mapsInitialized, []() {
+    // 在代码中定义的材料；其余材料及全部闪烁体的组成和光学性质在材料数据库中（见MaterialDatabase）
+    // Vacuum在静态初始化时就被使用（g_world_material），不能依赖数据库文件
     materialMap["Vacuum"] = []() { return MyMaterials::Vacuum(); };
-    materialMap["Air"] = []() { return MyMaterials::Air(); };
-    materialMap["AirKiller"] = []() { return MyMaterials::AirKiller(); };
-    materialMap["Water"] = []() { return MyMaterials::Water(); };
-    materialMap["Silicon"] = []() { return MyMaterials::Silicon(); };
-    materialMap["Aluminium"] = []() { return MyMaterials::Aluminium(); };
-    materialMap["Al"] = []() { return MyMaterials::Aluminium(); };
-    materialMap["Iron"] = []() { return MyMaterials::Iron(); };
-    materialMap["Lead"] = []() { return MyMaterials::Lead(); };
-    materialMap["Brass"] = []() { return MyMaterials::Brass(); };
-    materialMap["Tungsten"] = []() { return MyMaterials::Tungsten(); };
-    materialMap["TungstenLight"] = []() { return MyMaterials::TungstenLight(); };
-    materialMap["Quartz"] = []() { return MyMaterials::Quartz(); };
-    materialMap["OpticalGrease"] = []() { return MyMaterials::OpticalGrease(); };
-    materialMap["PVC"] = []() { return MyMaterials::PVC(); };
-    materialMap["CuAir"] = []() { return MyMaterials::CuAir(); };
-    materialMap["Cu"] = []() { return MyMaterials::Cu(); };
-    materialMap["LAPPD_Average"] = []() { return MyMaterials::LAPPD_Average(); };
-    materialMap["StainlessSteel"] = []() { return MyMaterials::StainlessSteel(); };
-    materialMap["Copper"] = []() { return MyMaterials::Copper(); };
-    materialMap["ESR_Vikuiti"] = []() { return MyMaterials::ESR_Vikuiti(); };
-    materialMap["LAPPD_Window"] = []() { return MyMaterials::LAPPD_Window(); };
-    materialMap["LAPPD_MCP"] = []() { return MyMaterials::LAPPD_MCP(); };
-    materialMap["Epoxy"] = []() { return MyMaterials::Epoxy(); };
-    materialMap["LAPPD_PCB"] = []() { return MyMaterials::LAPPD_PCB(); };
-    materialMap["GarthTypographicAlloy"] = []() { return MyMaterials::GarthTypographicAlloy(); };
-    materialMap["Tyvek"] = []() { return MyMaterials::Tyvek(); };
-    materialMap["PMMA"] = []() { return MyMaterials::PMMA(); };
-    materialMap["Shashlik_Polystyrene"] = []() { return MyMaterials::Shashlik_Polystyrene(); };
-    
-    // 闪烁体材料映射
-    scintillatorMap["BaF2"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::BaF2(ly, rs, bc); };
-    scintillatorMap["NaI_Tl"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::NaI_Tl(ly, rs, bc); };
-    scintillatorMap["CsI_Tl"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::CsI_Tl(ly, rs, bc); };
-    scintillatorMap["CsI"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::CsI(ly, rs, bc); };
-    scintillatorMap["GOS"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::GOS(ly, rs, bc); };
-    scintillatorMap["LSO"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::LSO(ly, rs, bc); };
-    scintillatorMap["YSO"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::YSO(ly, rs, bc); };
-    scintillatorMap["LYSO"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::LYSO(ly, rs, bc); };
-    scintillatorMap["LuAG_Ce"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::LuAG_Ce(ly, rs, bc); };
-    scintillatorMap["LuAG_Pr"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::LuAG_Pr(ly, rs, bc); };
-    scintillatorMap["DSB_Ce"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::DSB_Ce(ly, rs, bc); };
-    scintillatorMap["SiO2_Ce"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::SiO2_Ce(ly, rs, bc); };
-    scintillatorMap["BGO"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::BGO(ly, rs, bc); };
-    scintillatorMap["PWO"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::PWO(ly, rs, bc); };
-    scintillatorMap["CWO"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::CWO(ly, rs, bc); };
-    scintillatorMap["YAG_Ce"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::YAG_Ce(ly, rs, bc); };
-    scintillatorMap["GAGG_Ce_Mg"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::GAGG_Ce_Mg(ly, rs, bc); };
-    scintillatorMap["GAGG_ILM"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::GAGG_ILM(ly, rs, bc); };
-    scintillatorMap["GFAG"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::GFAG(ly, rs, bc); };
-    scintillatorMap["GYAGG"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::GYAGG(ly, rs, bc); };
-    scintillatorMap["GAGG_very_fast"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::GAGG_very_fast(ly, rs, bc); };
-    scintillatorMap["GAGG_slow"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::GAGG_slow(ly, rs, bc); };
-    scintillatorMap["Polystyrene"] = [](G4double ly, G4double rs, G4double bc) { return MyMaterials::Polystyrene(ly, rs, bc); };
-    
-    // 标记为已初始化
-    mapsInitialized = true;
+  });
 }
 
 // 通过材料名称获取材料
 G4Material* MaterialManager::GetMaterial(const G4String& materialName) {
     // 确保映射已初始化
-    if (!mapsInitialized) {
-        InitializeMaterialMaps();
-    }
+    InitializeMaterialMaps();
     
-    // 查找普通材料
-    auto it = materialMap.find(materialName);
+    // 数据库中的子材料会递归调用本函数，因此使用递归锁
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex);
+
+    // 已创建过的材料直接返回，别名与其指向的材料共用同一个缓存项
+    G4String name = MaterialDatabase::Instance().ResolveName(materialName);
+    auto cached = materialCache.find(name);
+    if (cached != materialCache.end()) {
+        return cached->second;
+    }
+    ScopedBuildTimer timer;
+
+    // 查找代码中定义的材料
+    auto it = materialMap.find(name);
     if (it != materialMap.end()) {
-        return it->second();
+        G4Material* material = it->second();
+        OpticalTableResampler::Resample(material);
+        materialCache[name] = material;
+        return material;
+    }
+
+    // 查找材料数据库
+    MaterialDatabase& database = MaterialDatabase::Instance();
+    if (database.HasMaterial(name) && !database.IsScintillator(name)) {
+        G4Material* material = database.BuildMaterial(name);
+        OpticalTableResampler::Resample(material);
+        materialCache[name] = material;
+        return material;
     }
     
     // 如果不是普通材料，返回nullptr
@@ -97,14 +83,34 @@ G4Material* MaterialManager::GetScintillator(
     G4double attenuationLength, 
     G4double birksConstant) {
     // 确保映射已初始化
-    if (!mapsInitialized) {
-        InitializeMaterialMaps();
-    }
+    InitializeMaterialMaps();
     
-    // 查找闪烁体材料
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex);
+
+    // 相同参数的闪烁体只创建一次
+    ScintillatorKey key(materialName, lightYield, attenuationLength, birksConstant);
+    auto cached = scintillatorCache.find(key);
+    if (cached != scintillatorCache.end()) {
+        return cached->second;
+    }
+    ScopedBuildTimer timer;
+
+    // 查找闪烁体材料，代码中定义的优先于数据库
+    G4Material* material = nullptr;
     auto it = scintillatorMap.find(materialName);
     if (it != scintillatorMap.end()) {
-        return it->second(lightYield, attenuationLength, birksConstant);
+        material = it->second(lightYield, attenuationLength, birksConstant);
+    }
+    else if (MaterialDatabase::Instance().IsScintillator(materialName)) {
+        material = MaterialDatabase::Instance().BuildMaterial(materialName, lightYield, attenuationLength, birksConstant);
+    }
+    if (material) {
+        // 不同参数的变体使用不同的名称
+        material->SetName(fmt("{}_LY{}_ATT{}_BK{}", materialName, lightYield, attenuationLength, birksConstant));
+        OpticalTableResampler::Resample(material);
+        scintillatorCache[key] = material;
+        myPrint(DEBUG, fmt("Created scintillator material {}", material->GetName()));
+        return material;
     }
     
     // 如果不是闪烁体材料，返回nullptr
@@ -114,33 +120,28 @@ G4Material* MaterialManager::GetScintillator(
 // 检查是否支持指定的材料
 bool MaterialManager::IsSupportedMaterial(const G4String& materialName) {
     // 确保映射已初始化
-    if (!mapsInitialized) {
-        InitializeMaterialMaps();
-    }
+    InitializeMaterialMaps();
     
-    return materialMap.find(materialName) != materialMap.end();
+    if (materialMap.find(materialName) != materialMap.end()) return true;
+    MaterialDatabase& database = MaterialDatabase::Instance();
+    return database.HasMaterial(materialName) && !database.IsScintillator(materialName);
 }
 
 // 检查是否支持指定的闪烁体材料
 bool MaterialManager::IsSupportedScintillator(const G4String& materialName) {
     // 确保映射已初始化
-    if (!mapsInitialized) {
-        InitializeMaterialMaps();
-    }
+    InitializeMaterialMaps();
     
-    return scintillatorMap.find(materialName) != scintillatorMap.end();
+    return scintillatorMap.find(materialName) != scintillatorMap.end()
+           || MaterialDatabase::Instance().IsScintillator(materialName);
 }
 
 // 获取所有支持的材料名称列表
 std::vector<G4String> MaterialManager::GetSupportedMaterials() {
     // 确保映射已初始化
-    if (!mapsInitialized) {
-        InitializeMaterialMaps();
-    }
-    
-    std::vector<G4String> materials;
-    materials.reserve(materialMap.size());
+    InitializeMaterialMaps();
     
+    std::vector<G4String> materials = MaterialDatabase::Instance().GetMaterialNames(false);
     for (const auto& pair : materialMap) {
         materials.push_back(pair.first);
     }
@@ -151,16 +152,24 @@ std::vector<G4String> MaterialManager::GetSupportedMaterials() {
 // 获取所有支持的闪烁体材料名称列表
 std::vector<G4String> MaterialManager::GetSupportedScintillators() {
     // 确保映射已初始化
-    if (!mapsInitialized) {
-        InitializeMaterialMaps();
-    }
-    
-    std::vector<G4String> scintillators;
-    scintillators.reserve(scintillatorMap.size());
+    InitializeMaterialMaps();
     
+    std::vector<G4String> scintillators = MaterialDatabase::Instance().GetMaterialNames(true);
     for (const auto& pair : scintillatorMap) {
         scintillators.push_back(pair.first);
     }
     
     return scintillators;
-} 
\ No newline at end of file
+}
+
+// 获取已缓存的材料数量
+size_t MaterialManager::GetNumberOfCachedMaterials() {
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex);
+    return materialCache.size() + scintillatorCache.size();
+}
+
+// 获取构建材料的累计耗时
+G4double MaterialManager::GetBuildTime() {
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex);
+    return buildTime;
+}
@@ -0,0 +1,16 @@
+#include "MyEventInfo.hh"
+#include "G4ios.hh"
+
+MyEventInfo::MyEventInfo()
+ : G4VUserEventInformation(), fWeight(1.0), fFluencePerPrimary(0.0)
+{}
+
+MyEventInfo::~MyEventInfo()
+{}
+
+void MyEventInfo::Print() const
+{
+    G4cout << "MyEventInfo: weight = " << fWeight
+           << ", fluence per primary = " << fFluencePerPrimary
+           << ", seeds = " << fSeeds.engine[0] << " " << fSeeds.engine[1] << " " << fSeeds.aux << G4endl;
+}
@@ -72,3 +72,9 @@ void MyTrackInfo::InheritPassedLayers_secondary(const MyTrackInfo* parentInfo)
         }
     }
 }
+
+bool MyTrackInfo::HasSamePassedLayers(const MyTrackInfo* other) const
+{
+    return other && fPassedLayers == other->fPassedLayers &&
+           fPassedLayers_secondary == other->fPassedLayers_secondary;
+}
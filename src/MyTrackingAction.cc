@@ -1,5 +1,6 @@
 #include "MyTrackingAction.hh"
 #include "MyTrackInfo.hh"
+#include "EventReplay.hh"
 #include "G4Track.hh"
 #include "G4VUserTrackInformation.hh"
 
@@ -21,5 +22,8 @@ void MyTrackingAction::PreUserTrackingAction(const G4Track* track)
     }
 }
 
-void MyTrackingAction::PostUserTrackingAction(const G4Track* /*track*/)
-{}
+void MyTrackingAction::PostUserTrackingAction(const G4Track* track)
+{
+    // 只在单事件重放时输出光学光子径迹
+    if (EventReplay::IsActive()) EventReplay::DumpPhoton(track);
+}
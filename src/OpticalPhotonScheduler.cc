@@ -0,0 +1,331 @@
+#include "OpticalPhotonScheduler.hh"
+#include "EventSeeder.hh"
+#include "EventWatchdog.hh"
+#include "MyEventInfo.hh"
+#include "MyTrackInfo.hh"
+#include "ScintillatorLayerManager.hh"
+#include "utilities.hh"
+
+#include "G4DynamicParticle.hh"
+#include "G4Event.hh"
+#include "G4EventManager.hh"
+#include "G4Exception.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4ProcessTable.hh"
+#include "G4ProcessVector.hh"
+#include "G4RunManager.hh"
+#include "G4TaskRunManager.hh"
+#include "G4Threading.hh"
+#include "G4Track.hh"
+#include "G4TrackVector.hh"
+#include "G4VProcess.hh"
+
+#include <algorithm>
+
+G4int OpticalPhotonScheduler::fBatchSize = 0;
+std::mutex OpticalPhotonScheduler::fMutex;
+std::condition_variable OpticalPhotonScheduler::fCondition;
+std::deque<std::shared_ptr<OpticalPhotonScheduler::Work>> OpticalPhotonScheduler::fQueue;
+G4int OpticalPhotonScheduler::fActiveWorkers = 0;
+G4ThreadLocal OpticalPhotonScheduler::ThreadState* OpticalPhotonScheduler::fState = nullptr;
+G4ThreadLocal OpticalPhotonScheduler::BatchResult* OpticalPhotonScheduler::fCurrentBatch = nullptr;
+G4ThreadLocal G4bool OpticalPhotonScheduler::fHelping = false;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::SetBatchSize(G4int photons)
+{
+  // Tasking的工作线程在所有事件任务结束后才到达EndOfRunAction，其他线程的批只能由本线程处理
+  if (photons > 0 && dynamic_cast<G4TaskRunManager*>(G4RunManager::GetRunManager()) != nullptr) {
+    G4ExceptionDescription ed;
+    ed << "Optical photon batching needs -runManager MT. Worker threads of the Tasking run manager only "
+       << "reach EndOfRunAction after all event tasks have finished and cannot take batches of other threads; "
+       << "batching stays disabled.";
+    G4Exception("OpticalPhotonScheduler::SetBatchSize", "BatchingNotSupported", JustWarning, ed);
+    photons = 0;
+  }
+  fBatchSize = photons;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+OpticalPhotonScheduler::ThreadState& OpticalPhotonScheduler::GetState()
+{
+  if (fState == nullptr) fState = new ThreadState();
+  return *fState;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::BeginOfRun()
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  fActiveWorkers++;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::HelpUntilRunEnd()
+{
+  std::unique_lock<std::mutex> lock(fMutex);
+  fActiveWorkers--;
+  fCondition.notify_all();
+  if (!IsEnabled()) return;
+
+  // 还有线程在事件循环中时，它们随时可能交出新的批，因此等到所有线程都结束事件循环；
+  // EndOfRunAction中几何仍处于关闭状态，可以直接处理事件
+  G4int nBatches = 0;
+  while (true) {
+    fCondition.wait(lock, [] { return !fQueue.empty() || fActiveWorkers <= 0; });
+    if (fQueue.empty()) break;
+
+    std::shared_ptr<Work> work = fQueue.front();
+    size_t batch = work->nextBatch++;
+    if (work->nextBatch == work->results.size()) fQueue.pop_front();
+    lock.unlock();
+    ProcessBatch(work, batch);
+    nBatches++;
+    lock.lock();
+  }
+
+  if (nBatches > 0) {
+    myPrint(INFO, f("Thread %d processed %d optical photon batches of other threads",
+                    G4Threading::G4GetThreadId(), nBatches));
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::PrepareNewEvent()
+{
+  if (fHelping) return;
+  Cancel(GetState());
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4bool OpticalPhotonScheduler::Collect(const G4Track* track)
+{
+  // 批中产生的光子（波长位移）在批内处理
+  if (!IsEnabled() || fHelping || fCurrentBatch != nullptr) return false;
+  if (track->GetDefinition() != G4OpticalPhoton::Definition()) return false;
+
+  ThreadState& state = GetState();
+  if (state.work) return false;
+
+  Photon photon;
+  photon.position = track->GetPosition();
+  photon.direction = track->GetMomentumDirection();
+  photon.polarization = track->GetPolarization();
+  photon.energy = track->GetKineticEnergy();
+  photon.time = track->GetGlobalTime();
+  photon.weight = track->GetWeight();
+  photon.parentID = track->GetParentID();
+  photon.creator = -1;
+  if (const G4VProcess* creator = track->GetCreatorProcess()) {
+    auto it = state.creatorIndex.find(creator);
+    if (it == state.creatorIndex.end()) {
+      it = state.creatorIndex.emplace(creator, static_cast<G4int>(state.creators.size())).first;
+      state.creators.push_back(creator->GetProcessName());
+    }
+    photon.creator = it->second;
+  }
+  // 层标记（CustomScorer使用）随光子保存，同一步产生的光子标记相同，只存一份
+  photon.trackInfo = -1;
+  if (auto trackInfo = dynamic_cast<const MyTrackInfo*>(track->GetUserInformation())) {
+    if (state.trackInfos.empty() || !state.trackInfos.back()->HasSamePassedLayers(trackInfo)) {
+      state.trackInfos.push_back(std::make_shared<const MyTrackInfo>(*trackInfo));
+    }
+    photon.trackInfo = static_cast<G4int>(state.trackInfos.size()) - 1;
+  }
+  state.photons.push_back(photon);
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::NewStage()
+{
+  if (!IsEnabled()) return;
+  ThreadState& state = GetState();
+
+  // 为其他线程处理批：第一次NewStage压入批的光子，批处理完后事件结束
+  if (fHelping) {
+    if (!state.stacked) {
+      state.stacked = true;
+      StackBatch(*state.work, state.batch);
+    }
+    return;
+  }
+
+  const G4Event* event = G4EventManager::GetEventManager()->GetConstCurrentEvent();
+  if (event != nullptr && event->IsAborted()) {
+    Cancel(state);
+    return;
+  }
+
+  // 本线程的上一批处理完毕
+  if (fCurrentBatch != nullptr) {
+    fCurrentBatch = nullptr;
+    Complete(*state.work);
+  }
+
+  // 带电粒子阶段结束，交出暂存的光子
+  if (!state.work) {
+    if (state.photons.empty()) return;
+    Dispatch(state);
+  }
+
+  Work& work = *state.work;
+  std::unique_lock<std::mutex> lock(fMutex);
+  if (work.nextBatch < work.results.size()) {
+    size_t batch = work.nextBatch++;
+    if (work.nextBatch == work.results.size()) {
+      auto it = std::find(fQueue.begin(), fQueue.end(), state.work);
+      if (it != fQueue.end()) fQueue.erase(it);
+    }
+    lock.unlock();
+    state.batch = static_cast<G4int>(batch);
+    StackBatch(work, batch);
+    return;
+  }
+
+  // 其余的批已被其他线程取走，等待它们处理完；堆栈为空，返回后事件结束
+  fCondition.wait(lock, [&work] { return work.nDone == work.results.size(); });
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+std::vector<OpticalPhotonScheduler::BatchResult> OpticalPhotonScheduler::TakeResults()
+{
+  std::vector<BatchResult> results;
+  if (fHelping) return results;
+
+  ThreadState& state = GetState();
+  if (state.work) {
+    results.swap(state.work->results);
+    state.work.reset();
+    state.batch = -1;
+  }
+  return results;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::Dispatch(ThreadState& state)
+{
+  auto work = std::make_shared<Work>();
+  const G4Event* event = G4EventManager::GetEventManager()->GetConstCurrentEvent();
+  work->eventID = event->GetEventID();
+  auto eventInfo = dynamic_cast<MyEventInfo*>(event->GetUserInformation());
+  work->seed = eventInfo ? eventInfo->GetSeeds().aux : static_cast<std::uint64_t>(work->eventID);
+  work->photons.swap(state.photons);
+  work->creators.swap(state.creators);
+  work->trackInfos.swap(state.trackInfos);
+  state.creatorIndex.clear();
+  work->batchSize = fBatchSize;
+  work->results.resize((work->photons.size() + work->batchSize - 1) / work->batchSize);
+  state.work = work;
+
+  myPrint(DEBUG, f("Event %d: %zu optical photons in %zu batches", work->eventID,
+                   work->photons.size(), work->results.size()));
+
+  // 只有一批时由本线程处理，不放入队列
+  if (work->results.size() > 1) {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fQueue.push_back(work);
+    fCondition.notify_all();
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::StackBatch(Work& work, size_t batch)
+{
+  BatchResult& result = work.results[batch];
+  result.deposits.assign(ScintillatorLayerManager::GetInstance().GetSnapshot().Size(), 0.);
+  fCurrentBatch = &result;
+
+  // 各线程有自己的过程对象，按名称找到本线程的产生过程
+  std::vector<const G4VProcess*> creators;
+  for (const auto& name : work.creators) {
+    G4ProcessVector* processes = G4ProcessTable::GetProcessTable()->FindProcesses(name);
+    creators.push_back(processes != nullptr && processes->size() > 0 ? (*processes)[0] : nullptr);
+    delete processes;
+  }
+
+  EventSeeder::SeedBatch(work.seed, static_cast<G4int>(batch));
+
+  size_t first = batch * work.batchSize;
+  size_t last = std::min(first + work.batchSize, work.photons.size());
+  G4TrackVector tracks;
+  for (size_t i = first; i < last; i++) {
+    const Photon& photon = work.photons[i];
+    G4DynamicParticle* particle = new G4DynamicParticle(G4OpticalPhoton::Definition(), photon.direction, photon.energy);
+    particle->SetPolarization(photon.polarization);
+    G4Track* track = new G4Track(particle, photon.time, photon.position);
+    track->SetWeight(photon.weight);
+    track->SetParentID(photon.parentID);
+    if (photon.creator >= 0) track->SetCreatorProcess(creators[photon.creator]);
+    if (photon.trackInfo >= 0) track->SetUserInformation(new MyTrackInfo(*work.trackInfos[photon.trackInfo]));
+    tracks.push_back(track);
+  }
+  G4EventManager::GetEventManager()->StackTracks(&tracks);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::ProcessBatch(const std::shared_ptr<Work>& work, size_t batch)
+{
+  ThreadState& state = GetState();
+  state.work = work;
+  state.batch = static_cast<G4int>(batch);
+  state.stacked = false;
+  fHelping = true;
+
+  // 事件号取源事件的，相空间记录等按源事件编号
+  G4Event* event = new G4Event(work->eventID);
+  MyEventInfo* eventInfo = new MyEventInfo();
+  event->SetUserInformation(eventInfo);
+  G4EventManager::GetEventManager()->ProcessOneEvent(event);
+
+  if (event->IsAborted()) {
+    work->results[batch].abortReason =
+        eventInfo->GetAbortReason().empty() ? G4String(EventWatchdog::kAbortOther) : eventInfo->GetAbortReason();
+  }
+  delete event;
+
+  fCurrentBatch = nullptr;
+  fHelping = false;
+  state.work.reset();
+  state.batch = -1;
+  Complete(*work);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::Complete(Work& work)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  work.nDone++;
+  fCondition.notify_all();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void OpticalPhotonScheduler::Cancel(ThreadState& state)
+{
+  // 事件被中止：其余的批不再处理，已被其他线程取走的批处理完后结果被丢弃
+  fCurrentBatch = nullptr;
+  if (state.work) {
+    std::lock_guard<std::mutex> lock(fMutex);
+    auto it = std::find(fQueue.begin(), fQueue.end(), state.work);
+    if (it != fQueue.end()) fQueue.erase(it);
+  }
+  state.work.reset();
+  state.batch = -1;
+  state.photons.clear();
+  state.creators.clear();
+  state.creatorIndex.clear();
+  state.trackInfos.clear();
+}
@@ -0,0 +1,155 @@
+#include "OpticalPhotonSource.hh"
+
+#include <algorithm>
+
+#include "G4DynamicParticle.hh"
+#include "G4Event.hh"
+#include "G4Exception.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4PrimaryParticle.hh"
+#include "G4PrimaryVertex.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Track.hh"
+#include "G4VSolid.hh"
+#include "Randomize.hh"
+
+#include "CompScintSimDetectorConstruction.hh"
+#include "MyPhysicalVolume.hh"
+#include "utilities.hh"
+
+OpticalPhotonSource::OpticalPhotonSource()
+    : fLayerID(1), fPhotonsPerEvent(1000), fChunkSize(10000), fFallbackEnergy(2.25 * eV),
+      fInitialized(false), fPending(0), fSolid(nullptr)
+{}
+
+void OpticalPhotonSource::Initialize(const CompScintSimDetectorConstruction* detector)
+{
+    if (fInitialized) return;
+
+    G4String layerName = "scint_layer_" + std::to_string(fLayerID);
+    VolumeFrame layer = detector->GetVolumeFrame(layerName);
+    G4LogicalVolume* l_layer = layer.logical;
+    fSolid = l_layer->GetSolid();
+    fSolid->BoundingLimits(fLocalMin, fLocalMax);
+    fTransform = layer.GetTransform();
+
+    // 由材料的SCINTILLATIONCOMPONENT1建立发射谱的累积分布
+    fSpectrumEnergy.clear();
+    fSpectrumCDF.clear();
+    G4MaterialPropertiesTable* mpt = l_layer->GetMaterial()->GetMaterialPropertiesTable();
+    G4MaterialPropertyVector* spectrum = mpt ? mpt->GetProperty("SCINTILLATIONCOMPONENT1") : nullptr;
+    if (spectrum && spectrum->GetVectorLength() > 1) {
+        G4double sum = 0;
+        fSpectrumEnergy.push_back(spectrum->Energy(0));
+        fSpectrumCDF.push_back(0);
+        for (size_t i = 1; i < spectrum->GetVectorLength(); i++) {
+            sum += 0.5 * ((*spectrum)[i] + (*spectrum)[i - 1]) * (spectrum->Energy(i) - spectrum->Energy(i - 1));
+            fSpectrumEnergy.push_back(spectrum->Energy(i));
+            fSpectrumCDF.push_back(sum);
+        }
+        for (auto& value : fSpectrumCDF) {
+            value /= sum;
+        }
+    }
+    else {
+        G4ExceptionDescription ed;
+        ed << "Material " << l_layer->GetMaterial()->GetName()
+           << " has no SCINTILLATIONCOMPONENT1, optical photons use " << fFallbackEnergy / eV << " eV";
+        G4Exception("OpticalPhotonSource::Initialize", "NoEmissionSpectrum", JustWarning, ed);
+    }
+
+    fInitialized = true;
+    G4cout << "Optical photon source initialized: " << layerName << " ("
+           << l_layer->GetMaterial()->GetName() << "), " << fPhotonsPerEvent
+           << " photons per event in chunks of " << fChunkSize << G4endl;
+}
+
+void OpticalPhotonSource::SamplePhoton(G4ThreeVector& position, G4ThreeVector& direction,
+                                       G4ThreeVector& polarization, G4double& energy) const
+{
+    // 在包围盒内抽样，舍弃落在实体外的点
+    G4ThreeVector size = fLocalMax - fLocalMin;
+    G4ThreeVector local;
+    G4int attempts = 0;
+    do {
+        local.set(fLocalMin.x() + size.x() * G4UniformRand(),
+                  fLocalMin.y() + size.y() * G4UniformRand(),
+                  fLocalMin.z() + size.z() * G4UniformRand());
+        if (++attempts > 100000) {
+            G4Exception("OpticalPhotonSource::SamplePhoton", "SamplingFailed", FatalException,
+                        "Could not sample a point inside the scintillator layer");
+        }
+    } while (fSolid->Inside(local) != kInside);
+    position = fTransform * HepGeom::Point3D<G4double>(local);
+
+    // 各向同性方向
+    G4double cosTheta = 1 - 2 * G4UniformRand();
+    G4double sinTheta = std::sqrt((1 - cosTheta) * (1 + cosTheta));
+    G4double phi = twopi * G4UniformRand();
+    G4double sinPhi = std::sin(phi);
+    G4double cosPhi = std::cos(phi);
+    direction.set(sinTheta * cosPhi, sinTheta * sinPhi, cosTheta);
+
+    // 随机偏振，垂直于传播方向（与G4Scintillation一致）
+    G4ThreeVector parallel(cosTheta * cosPhi, cosTheta * sinPhi, -sinTheta);
+    G4ThreeVector perpendicular = direction.cross(parallel);
+    G4double polPhi = twopi * G4UniformRand();
+    polarization = (std::cos(polPhi) * parallel + std::sin(polPhi) * perpendicular).unit();
+
+    // 按发射谱抽样能量
+    if (fSpectrumCDF.empty()) {
+        energy = fFallbackEnergy;
+        return;
+    }
+    G4double u = G4UniformRand();
+    size_t i = std::upper_bound(fSpectrumCDF.begin(), fSpectrumCDF.end(), u) - fSpectrumCDF.begin();
+    i = std::min(std::max<size_t>(i, 1), fSpectrumCDF.size() - 1);
+    G4double dc = fSpectrumCDF[i] - fSpectrumCDF[i - 1];
+    G4double t = dc > 0 ? (u - fSpectrumCDF[i - 1]) / dc : 0;
+    energy = fSpectrumEnergy[i - 1] + t * (fSpectrumEnergy[i] - fSpectrumEnergy[i - 1]);
+}
+
+void OpticalPhotonSource::GeneratePrimaries(G4Event* event, const CompScintSimDetectorConstruction* detector)
+{
+    Initialize(detector);
+
+    G4long nFirst = std::min<G4long>(fPhotonsPerEvent, fChunkSize);
+    fPending = fPhotonsPerEvent - nFirst;
+
+    G4ThreeVector position, direction, polarization;
+    G4double energy;
+    for (G4long i = 0; i < nFirst; i++) {
+        SamplePhoton(position, direction, polarization, energy);
+        G4PrimaryParticle* particle = new G4PrimaryParticle(G4OpticalPhoton::Definition());
+        particle->SetKineticEnergy(energy);
+        particle->SetMomentumDirection(direction);
+        particle->SetPolarization(polarization);
+        G4PrimaryVertex* vertex = new G4PrimaryVertex(position, 0.);
+        vertex->SetPrimary(particle);
+        event->AddPrimaryVertex(vertex);
+    }
+
+    myPrint(DEBUG, fmt("Optical photon source generated {} primaries, {} pending", nFirst, fPending));
+}
+
+G4int OpticalPhotonSource::FillNextChunk(G4TrackVector& tracks)
+{
+    G4int nChunk = static_cast<G4int>(std::min<G4long>(fPending, fChunkSize));
+    fPending -= nChunk;
+
+    G4ThreeVector position, direction, polarization;
+    G4double energy;
+    for (G4int i = 0; i < nChunk; i++) {
+        SamplePhoton(position, direction, polarization, energy);
+        G4DynamicParticle* photon = new G4DynamicParticle(G4OpticalPhoton::Definition(), direction, energy);
+        photon->SetPolarization(polarization);
+        G4Track* track = new G4Track(photon, 0., position);
+        track->SetParentID(0);
+        tracks.push_back(track);
+    }
+    return nChunk;
+}
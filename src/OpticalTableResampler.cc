@@ -0,0 +1,149 @@
+#include "OpticalTableResampler.hh"
+#include "utilities.hh"
+
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Version.hh"
+
+#include <algorithm>
+#include <cmath>
+
+G4double OpticalTableResampler::fTolerance = 0.;
+G4double OpticalTableResampler::fMaxError = 0.;
+
+namespace
+{
+  // 需要重采样的性质，光子每步都会查找
+  const char* kResampledProperties[] = {
+    "RINDEX", "ABSLENGTH", "RAYLEIGH", "WLSABSLENGTH",
+    "SCINTILLATIONCOMPONENT1", "SCINTILLATIONCOMPONENT2", "SCINTILLATIONCOMPONENT3",
+    "WLSCOMPONENT"
+  };
+
+  // 网格点数上限，达到上限时即使误差超过容差也停止加密
+  const size_t kMaxPoints = 4096;
+
+  // 每个网格区间内额外检查的点数
+  const G4int kCheckPointsPerBin = 3;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double OpticalTableResampler::Resample(G4Material* material)
+{
+  if (fTolerance <= 0. || material == nullptr) return 0.;
+
+  G4MaterialPropertiesTable* mpt = material->GetMaterialPropertiesTable();
+  if (mpt == nullptr) return 0.;
+
+  G4double materialError = 0.;
+  G4int nResampled = 0;
+  for (const char* key : kResampledProperties) {
+    G4MaterialPropertyVector* vector = mpt->GetProperty(key);
+    if (vector == nullptr) continue;
+
+    G4double error = 0.;
+    G4MaterialPropertyVector* resampled = ResampleVector(vector, error);
+    if (resampled == nullptr) continue;
+
+    myPrint(DEBUG, f("  %s %s: %zu -> %zu points, max error %.2e", material->GetName().c_str(), key,
+                     vector->GetVectorLength(), resampled->GetVectorLength(), error));
+
+    // 替换原表，RINDEX替换后GROUPVEL由G4MaterialPropertiesTable重新计算
+    mpt->RemoveProperty(key);
+    mpt->AddProperty(key, resampled);
+
+    materialError = std::max(materialError, error);
+    nResampled++;
+  }
+
+  if (nResampled > 0) {
+    fMaxError = std::max(fMaxError, materialError);
+    myPrint(INFO, f("Resampled %d optical tables of %s onto uniform grids, max error %.2e (tolerance %.2e, overall max %.2e)",
+                    nResampled, material->GetName().c_str(), materialError, fTolerance, fMaxError));
+  }
+  return materialError;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4MaterialPropertyVector* OpticalTableResampler::ResampleVector(
+  const G4MaterialPropertyVector* vector, G4double& maxError)
+{
+  size_t nOriginal = vector->GetVectorLength();
+  if (nOriginal <= 2) return nullptr;  // 两点的表查找本来就不需要二分
+
+  G4double eMin = vector->Energy(0);
+  G4double eMax = vector->Energy(nOriginal - 1);
+  if (!(eMax > eMin)) return nullptr;
+
+  // 以原始表的插值结果为基准（而不是原始数据点），保证查找结果在容差内与原表一致
+  std::vector<G4double> energies, values;
+  G4double step = 0.;
+  size_t nPoints = nOriginal;
+  while (true) {
+    step = (eMax - eMin) / (nPoints - 1);
+    energies.resize(nPoints);
+    values.resize(nPoints);
+    for (size_t i = 0; i < nPoints; i++) {
+      energies[i] = (i == nPoints - 1) ? eMax : eMin + i * step;
+      values[i] = vector->Value(energies[i]);
+    }
+
+    maxError = MaxError(vector, values, eMin, step);
+    if (maxError <= fTolerance) break;
+    if (nPoints >= kMaxPoints) {
+      myPrint(INFO, f("Optical table resampling stopped at %zu points, max error %.2e exceeds tolerance %.2e",
+                      nPoints, maxError, fTolerance));
+      break;
+    }
+    nPoints = std::min(2 * nPoints, kMaxPoints);
+  }
+
+  auto resampled = new G4MaterialPropertyVector(energies, values);
+#if G4VERSION_NUMBER >= 1100
+  // 每个对数查找分箱不超过一个网格间距，查找退化为直接索引
+  G4int binsPerDecade = static_cast<G4int>(std::ceil(std::log(10.) * eMax / step));
+  resampled->EnableLogBinSearch(binsPerDecade);
+#endif
+  return resampled;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double OpticalTableResampler::MaxError(const G4MaterialPropertyVector* vector,
+                                         const std::vector<G4double>& values,
+                                         G4double eMin, G4double step)
+{
+  // 误差相对于表中最大绝对值，避免发射谱尾部接近0时相对误差发散
+  G4double scale = 0.;
+  for (size_t i = 0; i < vector->GetVectorLength(); i++) {
+    scale = std::max(scale, std::abs((*vector)[i]));
+  }
+  if (scale <= 0.) return 0.;
+
+  size_t nBins = values.size() - 1;
+  auto uniformValue = [&](G4double energy) {
+    G4double t = (energy - eMin) / step;
+    size_t bin = std::min(static_cast<size_t>(std::max(t, 0.)), nBins - 1);
+    G4double frac = std::min(std::max(t - bin, 0.), 1.);
+    return values[bin] + frac * (values[bin + 1] - values[bin]);
+  };
+
+  G4double error = 0.;
+  auto check = [&](G4double energy) {
+    error = std::max(error, std::abs(uniformValue(energy) - vector->Value(energy)) / scale);
+  };
+
+  // 原始节点处线性插值的拐点误差最大
+  for (size_t i = 0; i < vector->GetVectorLength(); i++) {
+    check(vector->Energy(i));
+  }
+  for (size_t bin = 0; bin < nBins; bin++) {
+    for (G4int k = 1; k <= kCheckPointsPerBin; k++) {
+      check(eMin + (bin + k / (kCheckPointsPerBin + 1.)) * step);
+    }
+  }
+  return error;
+}
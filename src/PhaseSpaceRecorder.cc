@@ -0,0 +1,170 @@
+#include "PhaseSpaceRecorder.hh"
+
+#include <sstream>
+
+#include "G4EventManager.hh"
+#include "G4Event.hh"
+#include "G4LogicalVolume.hh"
+#include "G4RunManager.hh"
+#include "G4Step.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Track.hh"
+#include "G4VSolid.hh"
+
+#include "CompScintSimDetectorConstruction.hh"
+#include "MyPhysicalVolume.hh"
+#include "OpticalPhotonScheduler.hh"
+#include "utilities.hh"
+
+PhaseSpaceRecorder::PhaseSpaceRecorder()
+    : fKillAtPlane(false)
+{}
+
+void PhaseSpaceRecorder::BeginOfRun(G4int threadID, G4bool openFiles)
+{
+    fWriters.clear();
+    fPlaneZ.clear();
+    fRecordedTracks.clear();
+    fEventRecords.clear();
+    if (!IsEnabled()) return;
+
+    const CompScintSimDetectorConstruction* detector = dynamic_cast<const CompScintSimDetectorConstruction*>(
+        G4RunManager::GetRunManager()->GetUserDetectorConstruction());
+
+    for (const auto& plane : fPlanes) {
+        G4double z = plane.z;
+        if (plane.belowLayer > 0) {
+            if (!detector) {
+                G4Exception("PhaseSpaceRecorder::BeginOfRun", "CompScintSim_001", FatalException,
+                            "Detector construction is not found!");
+            }
+            VolumeFrame layer = detector->GetVolumeFrame("Layer_" + std::to_string(plane.belowLayer) + "_phys");
+            G4ThreeVector pMin, pMax;
+            layer.logical->GetSolid()->BoundingLimits(pMin, pMax);
+            z = layer.position.z() + pMin.z();
+        }
+        fPlaneZ.push_back(z);
+    }
+    fRecordedTracks.resize(fPlaneZ.size());
+    fEventRecords.resize(fPlaneZ.size());
+
+    if (!openFiles) return;
+
+    for (size_t i = 0; i < fPlaneZ.size(); i++) {
+        auto writer = std::make_unique<PrimaryFileWriter>();
+        writer->Open(GetPartFileName(threadID, i));
+        fWriters.push_back(std::move(writer));
+        myPrint(DEBUG, fmt("Phase space plane {} at z = {} mm", i, fPlaneZ[i] / mm));
+    }
+}
+
+void PhaseSpaceRecorder::EndOfRun()
+{
+    for (auto& writer : fWriters) {
+        writer->Close();
+    }
+    fWriters.clear();
+}
+
+void PhaseSpaceRecorder::BeginOfEvent()
+{
+    for (auto& tracks : fRecordedTracks) {
+        tracks.clear();
+    }
+    for (auto& records : fEventRecords) {
+        records.clear();
+    }
+}
+
+void PhaseSpaceRecorder::EndOfEvent(G4bool aborted)
+{
+    for (size_t i = 0; i < fEventRecords.size() && i < fWriters.size(); i++) {
+        if (!aborted) {
+            for (const auto& record : fEventRecords[i]) {
+                fWriters[i]->Write(record);
+            }
+        }
+        fEventRecords[i].clear();
+    }
+}
+
+void PhaseSpaceRecorder::ProcessStep(const G4Step* step)
+{
+    if (fWriters.empty()) return;
+
+    const G4StepPoint* preStepPoint = step->GetPreStepPoint();
+    const G4StepPoint* postStepPoint = step->GetPostStepPoint();
+    G4double preZ = preStepPoint->GetPosition().z();
+    G4double postZ = postStepPoint->GetPosition().z();
+    if (postZ >= preZ) return;
+
+    for (size_t i = 0; i < fPlaneZ.size(); i++) {
+        G4double planeZ = fPlaneZ[i];
+        if (!(preZ > planeZ && postZ <= planeZ)) continue;
+        if (!fRecordedTracks[i].insert(step->GetTrack()->GetTrackID()).second) continue;
+
+        // 线性插值得到穿过平面时的位置和时间；
+        // 若该步由几何边界限制，只有连续能损，能量同样插值，否则离散相互作用发生在步末，取步前能量
+        G4double frac = (preZ - planeZ) / (preZ - postZ);
+        G4ThreeVector position = preStepPoint->GetPosition()
+                                 + frac * (postStepPoint->GetPosition() - preStepPoint->GetPosition());
+        G4double time = preStepPoint->GetGlobalTime()
+                        + frac * (postStepPoint->GetGlobalTime() - preStepPoint->GetGlobalTime());
+        G4double energy = preStepPoint->GetKineticEnergy();
+        if (postStepPoint->GetStepStatus() == fGeomBoundary) {
+            energy += frac * (postStepPoint->GetKineticEnergy() - energy);
+        }
+        G4ThreeVector direction = preStepPoint->GetMomentumDirection();
+
+        PrimaryRecord record;
+        record.eventID = G4EventManager::GetEventManager()->GetConstCurrentEvent()->GetEventID();
+        record.particleCode = PrimaryFileReader::EncodeParticle(step->GetTrack()->GetDefinition());
+        record.energy = energy / MeV;
+        record.x = position.x() / mm;
+        record.y = position.y() / mm;
+        record.z = planeZ / mm;
+        record.dx = direction.x();
+        record.dy = direction.y();
+        record.dz = direction.z();
+        record.time = time / ns;
+        record.weight = preStepPoint->GetWeight();
+        if (OpticalPhotonScheduler::BatchResult* batch = OpticalPhotonScheduler::GetCurrentBatch()) {
+            // 光子批中的记录随批的结果交给源事件，按批的顺序写入
+            batch->crossings.resize(fPlaneZ.size());
+            batch->crossings[i].push_back(record);
+        } else {
+            fEventRecords[i].push_back(record);
+        }
+
+        if (fKillAtPlane) {
+            step->GetTrack()->SetTrackStatus(fStopAndKill);
+            return;
+        }
+    }
+}
+
+void PhaseSpaceRecorder::AddRecords(const std::vector<std::vector<PrimaryRecord>>& crossings)
+{
+    for (size_t i = 0; i < crossings.size() && i < fEventRecords.size(); i++) {
+        fEventRecords[i].insert(fEventRecords[i].end(), crossings[i].begin(), crossings[i].end());
+    }
+}
+
+G4String PhaseSpaceRecorder::GetPlaneFileName(size_t plane) const
+{
+    std::stringstream fileName;
+    size_t extPos = fFileName.rfind(".");
+    if (extPos != std::string::npos) {
+        fileName << fFileName.substr(0, extPos) << "_plane" << plane << fFileName.substr(extPos);
+    } else {
+        fileName << fFileName << "_plane" << plane;
+    }
+    return fileName.str();
+}
+
+G4String PhaseSpaceRecorder::GetPartFileName(G4int threadID, size_t plane) const
+{
+    std::stringstream fileName;
+    fileName << "thread" << threadID << "_" << GetPlaneFileName(plane) << ".part";
+    return fileName.str();
+}
@@ -0,0 +1,125 @@
+#include "PhysicsTableCache.hh"
+#include "utilities.hh"
+
+#include "G4Element.hh"
+#include "G4Material.hh"
+#include "G4ProductionCuts.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4Version.hh"
+#include "G4VUserPhysicsList.hh"
+
+#include <cstdlib>
+#include <filesystem>
+#include <sstream>
+#include <unistd.h>
+
+namespace
+{
+  // 未设置时取环境变量
+  G4String DefaultDirectory()
+  {
+    const char* env = std::getenv("COMPSCINTSIM_PHYSICS_CACHE");
+    return env ? env : "";
+  }
+}
+
+G4String PhysicsTableCache::fDirectory = DefaultDirectory();
+G4String PhysicsTableCache::fEntry;
+PhysicsTableCache::Status PhysicsTableCache::fStatus = PhysicsTableCache::kDisabled;
+G4VUserPhysicsList* PhysicsTableCache::fPhysicsList = nullptr;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void PhysicsTableCache::SetDirectory(const G4String& directory)
+{
+  fDirectory = (directory == "none") ? "" : directory;
+}
+
+const G4String& PhysicsTableCache::GetDirectory()
+{
+  return fDirectory;
+}
+
+const char* PhysicsTableCache::GetStatusName()
+{
+  switch (fStatus) {
+    case kCold: return "cold";
+    case kWarm: return "warm";
+    default: return "off";
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void PhysicsTableCache::Prepare(G4VUserPhysicsList* physicsList, const G4String& config)
+{
+  fStatus = kDisabled;
+  if (fDirectory.empty()) return;
+
+  fPhysicsList = physicsList;
+  fEntry = (std::filesystem::path(fDirectory) / f("%016llx", static_cast<unsigned long long>(Hash(config)))).string();
+
+  std::error_code ec;
+  if (std::filesystem::is_directory(fEntry, ec)) {
+    fStatus = kWarm;
+    physicsList->SetPhysicsTableRetrieved(fEntry);
+    myPrint(INFO, fmt("Retrieving physics tables from {}", fEntry));
+  }
+  else {
+    fStatus = kCold;
+    myPrint(INFO, fmt("Physics tables not cached, they will be stored in {}", fEntry));
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void PhysicsTableCache::Store()
+{
+  if (fStatus != kCold || fPhysicsList == nullptr) return;
+
+  // 先写入临时目录再改名，并行启动的进程不会读到写了一半的缓存
+  std::error_code ec;
+  std::string tmp = fEntry + ".tmp" + std::to_string(::getpid());
+  std::filesystem::create_directories(tmp, ec);
+  if (ec || !fPhysicsList->StorePhysicsTable(tmp)) {
+    myPrint(ERROR, fmt("Cannot store physics tables in {}", tmp));
+    std::filesystem::remove_all(tmp, ec);
+  }
+  else {
+    std::filesystem::rename(tmp, fEntry, ec);
+    if (ec) std::filesystem::remove_all(tmp, ec); // 其他进程已经写入
+    else myPrint(INFO, fmt("Physics tables stored in {}", fEntry));
+  }
+  // 每个配置只写一次
+  fStatus = kWarm;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+std::uint64_t PhysicsTableCache::Hash(const G4String& config)
+{
+  std::ostringstream ss;
+  ss.precision(17);
+  ss << G4VERSION_NUMBER << "|" << config << "|";
+
+  // 各区域的产生阈值（gamma、e-、e+、proton）
+  for (const G4Region* region : *G4RegionStore::GetInstance()) {
+    ss << region->GetName();
+    if (const G4ProductionCuts* cuts = region->GetProductionCuts()) {
+      for (G4int i = 0; i < 4; i++) ss << "," << cuts->GetProductionCut(i);
+    }
+    ss << ";";
+  }
+  ss << "|";
+
+  // 材料按创建顺序编号，物理表按材料编号存储，顺序也参与哈希
+  for (const G4Material* material : *G4Material::GetMaterialTable()) {
+    ss << material->GetName() << "," << material->GetDensity() << "," << material->GetState();
+    for (size_t i = 0; i < material->GetNumberOfElements(); i++) {
+      ss << "," << material->GetElement(i)->GetName() << ":" << material->GetFractionVector()[i];
+    }
+    ss << ";";
+  }
+  return HashBytes(ss.str());
+}
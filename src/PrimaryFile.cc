@@ -0,0 +1,320 @@
+#include "PrimaryFile.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "G4Event.hh"
+#include "G4Exception.hh"
+#include "G4IonTable.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4ParticleTable.hh"
+#include "G4PrimaryParticle.hh"
+#include "G4PrimaryVertex.hh"
+#include "G4SystemOfUnits.hh"
+
+#include "MyEventInfo.hh"
+#include "utilities.hh"
+
+namespace
+{
+  const char kPrimaryFileMagic[8] = {'C', 'S', 'S', 'P', 'R', 'I', 'M', '1'};
+  const uint32_t kPrimaryFileVersion = 1;
+
+  // 光学光子在部分Geant4版本中PDG编码为0，这里统一使用-22
+  const G4int kOpticalPhotonCode = -22;
+}
+
+// ---------------------------------- //
+// PrimaryFileWriter
+// ---------------------------------- //
+
+PrimaryFileWriter::PrimaryFileWriter() {}
+
+PrimaryFileWriter::~PrimaryFileWriter()
+{
+    Close();
+}
+
+bool PrimaryFileWriter::Open(const G4String& partFileName)
+{
+    Close();
+    fOut.open(partFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!fOut.is_open()) {
+        myPrint(ERROR, fmt("Could not open primary record file {} for writing!", partFileName));
+        return false;
+    }
+    return true;
+}
+
+void PrimaryFileWriter::Close()
+{
+    if (fOut.is_open()) {
+        fOut.close();
+    }
+}
+
+void PrimaryFileWriter::Write(const PrimaryRecord& record)
+{
+    fOut.write(reinterpret_cast<const char*>(&record), sizeof(PrimaryRecord));
+}
+
+void PrimaryFileWriter::WriteEvent(const G4Event* event)
+{
+    if (!fOut.is_open()) return;
+
+    for (G4int iv = 0; iv < event->GetNumberOfPrimaryVertex(); iv++) {
+        const G4PrimaryVertex* vertex = event->GetPrimaryVertex(iv);
+        for (const G4PrimaryParticle* particle = vertex->GetPrimary(); particle; particle = particle->GetNext()) {
+            PrimaryRecord record;
+            record.eventID = event->GetEventID();
+            record.particleCode = PrimaryFileReader::EncodeParticle(particle->GetG4code());
+            record.energy = particle->GetKineticEnergy() / MeV;
+            record.x = vertex->GetX0() / mm;
+            record.y = vertex->GetY0() / mm;
+            record.z = vertex->GetZ0() / mm;
+            G4ThreeVector direction = particle->GetMomentumDirection();
+            record.dx = direction.x();
+            record.dy = direction.y();
+            record.dz = direction.z();
+            record.time = vertex->GetT0() / ns;
+            record.weight = vertex->GetWeight() * particle->GetWeight();
+            Write(record);
+        }
+    }
+}
+
+G4long PrimaryFileWriter::Merge(const std::vector<G4String>& partFileNames,
+                                const G4String& outputFileName,
+                                G4long nSourceEvents)
+{
+    // 读入所有线程的记录
+    std::vector<PrimaryRecord> records;
+    for (const auto& partFileName : partFileNames) {
+        std::ifstream partFile(partFileName, std::ios::in | std::ios::binary);
+        if (!partFile.is_open()) continue;
+
+        PrimaryRecord record;
+        while (partFile.read(reinterpret_cast<char*>(&record), sizeof(PrimaryRecord))) {
+            records.push_back(record);
+        }
+        partFile.close();
+        std::remove(partFileName.c_str());
+    }
+
+    // 按eventID排序，同一事件内保持原有顺序
+    std::stable_sort(records.begin(), records.end(),
+                     [](const PrimaryRecord& a, const PrimaryRecord& b) { return a.eventID < b.eventID; });
+
+    // 建立事件索引
+    std::vector<uint64_t> eventOffsets;
+    for (size_t i = 0; i < records.size(); i++) {
+        if (i == 0 || records[i].eventID != records[i - 1].eventID) {
+            eventOffsets.push_back(i);
+        }
+    }
+    eventOffsets.push_back(records.size());
+
+    PrimaryFileHeader header;
+    std::memcpy(header.magic, kPrimaryFileMagic, sizeof(header.magic));
+    header.version = kPrimaryFileVersion;
+    header.recordSize = sizeof(PrimaryRecord);
+    header.nEvents = eventOffsets.size() - 1;
+    header.nRecords = records.size();
+    header.nSourceEvents = nSourceEvents;
+
+    // 先写入临时文件再改名覆盖配置的文件名：重放命令使用的是配置的文件名，
+    // 不能像CSV那样另起新文件名，否则下一次重放会读到上一次运行的旧文件
+    G4String tmpFileName = outputFileName + ".tmp";
+    std::ofstream outFile(tmpFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!outFile.is_open()) {
+        G4ExceptionDescription ed;
+        ed << "Cannot open primary file " << tmpFileName << " for writing";
+        G4Exception("PrimaryFileWriter::Merge", "FileNotWritable", JustWarning, ed);
+        return 0;
+    }
+    outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    outFile.write(reinterpret_cast<const char*>(eventOffsets.data()), eventOffsets.size() * sizeof(uint64_t));
+    outFile.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(PrimaryRecord));
+    outFile.close();
+    if (!outFile || std::rename(tmpFileName.c_str(), outputFileName.c_str()) != 0) {
+        G4ExceptionDescription ed;
+        ed << "Cannot write primary file " << outputFileName << ", records left in " << tmpFileName;
+        G4Exception("PrimaryFileWriter::Merge", "FileNotWritable", JustWarning, ed);
+        return 0;
+    }
+
+    G4cout << "Primary file written: " << outputFileName << " (" << header.nEvents << " events, "
+           << header.nRecords << " records)" << G4endl;
+    return records.size();
+}
+
+// ---------------------------------- //
+// PrimaryFileReader
+// ---------------------------------- //
+
+std::shared_ptr<const PrimaryFileReader> PrimaryFileReader::Open(const G4String& fileName)
+{
+    // 同一文件只映射一次，由所有线程共享
+    static std::mutex cacheMutex;
+    static std::map<G4String, std::weak_ptr<const PrimaryFileReader>> cache;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(fileName);
+    if (it != cache.end()) {
+        if (auto reader = it->second.lock()) {
+            return reader;
+        }
+    }
+
+    std::shared_ptr<const PrimaryFileReader> reader(new PrimaryFileReader(fileName));
+    cache[fileName] = reader;
+    return reader;
+}
+
+PrimaryFileReader::PrimaryFileReader(const G4String& fileName)
+    : fFileName(fileName), fData(nullptr), fSize(0),
+      fHeader(nullptr), fEventOffsets(nullptr), fRecords(nullptr)
+{
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        G4ExceptionDescription ed;
+        ed << "Cannot open primary file: " << fileName;
+        G4Exception("PrimaryFileReader::PrimaryFileReader", "FileNotFound", FatalException, ed);
+        return;
+    }
+
+    struct stat st;
+    fstat(fd, &st);
+    fSize = st.st_size;
+    if (fSize >= sizeof(PrimaryFileHeader)) {
+        fData = mmap(nullptr, fSize, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if (fData == nullptr || fData == MAP_FAILED) {
+        fData = nullptr;
+        G4ExceptionDescription ed;
+        ed << "Cannot map primary file: " << fileName;
+        G4Exception("PrimaryFileReader::PrimaryFileReader", "InvalidPrimaryFile", FatalException, ed);
+        return;
+    }
+
+    fHeader = static_cast<const PrimaryFileHeader*>(fData);
+    size_t expectedSize = sizeof(PrimaryFileHeader) + (fHeader->nEvents + 1) * sizeof(uint64_t)
+                          + fHeader->nRecords * sizeof(PrimaryRecord);
+    if (std::memcmp(fHeader->magic, kPrimaryFileMagic, sizeof(kPrimaryFileMagic)) != 0
+        || fHeader->version != kPrimaryFileVersion
+        || fHeader->recordSize != sizeof(PrimaryRecord)
+        || fSize < expectedSize
+        || fHeader->nEvents == 0) {
+        G4ExceptionDescription ed;
+        ed << "Invalid or empty primary file: " << fileName;
+        G4Exception("PrimaryFileReader::PrimaryFileReader", "InvalidPrimaryFile", FatalException, ed);
+        return;
+    }
+
+    const char* base = static_cast<const char*>(fData);
+    fEventOffsets = reinterpret_cast<const uint64_t*>(base + sizeof(PrimaryFileHeader));
+    fRecords = reinterpret_cast<const PrimaryRecord*>(
+        base + sizeof(PrimaryFileHeader) + (fHeader->nEvents + 1) * sizeof(uint64_t));
+
+    // 只读映射，提示内核顺序预读
+    madvise(fData, fSize, MADV_SEQUENTIAL);
+
+    G4cout << "Primary file mapped: " << fileName << " (" << fHeader->nEvents << " events, "
+           << fHeader->nRecords << " records, " << fHeader->nSourceEvents << " source events)" << G4endl;
+}
+
+PrimaryFileReader::~PrimaryFileReader()
+{
+    if (fData) {
+        munmap(fData, fSize);
+    }
+}
+
+const PrimaryRecord* PrimaryFileReader::GetEventRecords(G4int index, G4int& nRecords) const
+{
+    uint64_t first = fEventOffsets[index];
+    nRecords = static_cast<G4int>(fEventOffsets[index + 1] - first);
+    return fRecords + first;
+}
+
+const PrimaryRecord* PrimaryFileReader::FindEvent(G4int eventID, G4int& nRecords) const
+{
+    // 事件按eventID排序，对各事件的第一条记录二分查找
+    G4int lo = 0;
+    G4int hi = GetNumberOfEvents();
+    while (lo < hi) {
+        G4int mid = lo + (hi - lo) / 2;
+        if (fRecords[fEventOffsets[mid]].eventID < eventID) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < GetNumberOfEvents() && fRecords[fEventOffsets[lo]].eventID == eventID) {
+        return GetEventRecords(lo, nRecords);
+    }
+    nRecords = 0;
+    return nullptr;
+}
+
+void PrimaryFileReader::AddToEvent(G4Event* event, const PrimaryRecord* records, G4int nRecords)
+{
+    for (G4int i = 0; i < nRecords; i++) {
+        const PrimaryRecord& record = records[i];
+        G4ParticleDefinition* particleDef = DecodeParticle(record.particleCode);
+        if (!particleDef) {
+            myPrint(ERROR, fmt("Unknown particle code {} in primary file, record skipped.", record.particleCode));
+            continue;
+        }
+
+        G4PrimaryVertex* vertex = new G4PrimaryVertex(
+            G4ThreeVector(record.x, record.y, record.z) * mm, record.time * ns);
+        G4PrimaryParticle* particle = new G4PrimaryParticle(particleDef);
+        particle->SetKineticEnergy(record.energy * MeV);
+        particle->SetMomentumDirection(G4ThreeVector(record.dx, record.dy, record.dz));
+        vertex->SetPrimary(particle);
+        vertex->SetWeight(record.weight);
+        event->AddPrimaryVertex(vertex);
+    }
+
+    // 事件权重取第一条记录的权重
+    if (nRecords > 0) {
+        auto eventInfo = dynamic_cast<MyEventInfo*>(event->GetUserInformation());
+        if (eventInfo == nullptr) {
+            eventInfo = new MyEventInfo();
+            event->SetUserInformation(eventInfo);
+        }
+        eventInfo->SetWeight(records[0].weight);
+    }
+}
+
+G4int PrimaryFileReader::EncodeParticle(const G4ParticleDefinition* particle)
+{
+    if (particle == G4OpticalPhoton::Definition()) {
+        return kOpticalPhotonCode;
+    }
+    return particle->GetPDGEncoding();
+}
+
+G4ParticleDefinition* PrimaryFileReader::DecodeParticle(G4int particleCode)
+{
+    if (particleCode == kOpticalPhotonCode) {
+        return G4OpticalPhoton::Definition();
+    }
+    G4ParticleDefinition* particle = G4ParticleTable::GetParticleTable()->FindParticle(particleCode);
+    if (!particle && particleCode > 1000000000) {
+        particle = G4IonTable::GetIonTable()->GetIon(particleCode);
+    }
+    return particle;
+}
@@ -4,15 +4,33 @@
 #include "utilities.hh"
 #include <string> // 添加string头文件
 
+#include "G4Threading.hh"
+#include "G4VTouchable.hh"
+
 // ScintillatorLayerInfo方法实现
 G4Material* ScintillatorLayerInfo::GetScintMaterial() const {
-    return MaterialManager::GetScintillator(scint_material, scint_lightyield, 1, -1);
+    // 参数与DetectorConstruction中一致，从缓存中取得同一材料
+    return MaterialManager::GetScintillator(scint_material, scint_lightyield, 1000, -1);
 }
     
 G4Material* ScintillatorLayerInfo::GetCoatingMaterial() const {
     return MaterialManager::GetMaterial(coating_material);
 }
 
+bool ScintillatorLayerInfo::HasSameDefinition(const ScintillatorLayerInfo& other) const {
+    return readout_face == other.readout_face &&
+           scint_material == other.scint_material &&
+           scint_lightyield == other.scint_lightyield &&
+           scint_length == other.scint_length &&
+           scint_width == other.scint_width &&
+           scint_height == other.scint_height &&
+           coating_thickness == other.coating_thickness &&
+           coating_material == other.coating_material &&
+           fiber_core_diameter == other.fiber_core_diameter &&
+           fiber_cladding_diameter == other.fiber_cladding_diameter &&
+           production_cut == other.production_cut;
+}
+
 // ScintillatorLayerManager单例实现
 ScintillatorLayerManager& ScintillatorLayerManager::GetInstance() {
     static ScintillatorLayerManager instance;
@@ -21,12 +39,23 @@ ScintillatorLayerManager& ScintillatorLayerManager::GetInstance() {
 
 // 构造函数
 ScintillatorLayerManager::ScintillatorLayerManager() 
-    : m_totalStackHeight(0.0) 
+    : m_totalStackHeight(0.0)
 {
+    // 初始化之前返回空快照
+    m_snapshots.push_back(std::make_unique<LayerSnapshot>());
+    m_snapshot.store(m_snapshots.back().get(), std::memory_order_release);
 }
 
 // 从CSV文件初始化
 bool ScintillatorLayerManager::Initialize(const G4String& filename) {
+    // 工作线程只读取快照，不能修改层参数
+    if (!G4Threading::IsMasterThread()) {
+        G4Exception("ScintillatorLayerManager::Initialize",
+                    "NotOnMaster", FatalException,
+                    "Layer configuration must be loaded on the master thread");
+        return false;
+    }
+
     // 尝试在当前路径打开文件
     std::ifstream csvFile(filename);
     
@@ -106,6 +135,8 @@ bool ScintillatorLayerManager::Initialize(const G4String& filename) {
         layerInfo.coating_material = row[8];
         layerInfo.fiber_core_diameter = std::stod(row[9]);
         layerInfo.fiber_cladding_diameter = std::stod(row[10]);
+        // 可选列：闪烁体区域的产生阈值，缺省时使用物理列表的默认值
+        layerInfo.production_cut = (row.size() > 11 && !row[11].empty()) ? std::stod(row[11]) : 0.;
         
         // 存储层信息
         m_layerInfoMap[layerInfo.copynumber] = layerInfo;
@@ -175,6 +206,7 @@ bool ScintillatorLayerManager::Initialize(const G4String& filename) {
             ss << "coating_material: " << layer->coating_material << "\n";
             ss << "fiber_core_diameter: " << layer->GetFiberCoreDiameterUM()/um << " um\n";
             ss << "fiber_cladding_diameter: " << layer->GetFiberCladdingDiameterUM()/um << " um\n";
+            ss << "production_cut: " << layer->GetProductionCutMM()/mm << " mm\n";
             ss << "------------------------------------------------";
             
             myPrint(DEBUG, ss.str());
@@ -184,6 +216,24 @@ bool ScintillatorLayerManager::Initialize(const G4String& filename) {
     }
     myPrint(DEBUG, "===============================================================");
     
+    // 构建并发布新的快照
+    auto snapshot = std::make_unique<LayerSnapshot>();
+    for (G4int copynumber : m_copynumbers) {
+        const ScintillatorLayerInfo& layer = m_layerInfoMap.at(copynumber);
+        snapshot->copynumber.push_back(copynumber);
+        snapshot->readoutFace.push_back(layer.readout_face);
+        snapshot->lightYield.push_back(layer.scint_lightyield);
+        snapshot->scintLength.push_back(layer.GetScintLengthMM());
+        snapshot->scintWidth.push_back(layer.GetScintWidthMM());
+        snapshot->scintHeight.push_back(layer.GetScintHeightMM());
+        snapshot->coatingThickness.push_back(layer.GetCoatingThicknessNM());
+        snapshot->fiberCoreDiameter.push_back(layer.GetFiberCoreDiameterUM());
+        snapshot->fiberCladdingDiameter.push_back(layer.GetFiberCladdingDiameterUM());
+        snapshot->productionCut.push_back(layer.GetProductionCutMM());
+    }
+    m_snapshots.push_back(std::move(snapshot));
+    m_snapshot.store(m_snapshots.back().get(), std::memory_order_release);
+
     return true;
 }
 
@@ -223,6 +273,29 @@ const std::map<G4int, ScintillatorLayerInfo>& ScintillatorLayerManager::GetAllLa
     return m_layerInfoMap;
 }
 
+// 登记层的物理体
+void ScintillatorLayerManager::RegisterLayerVolume(const G4VPhysicalVolume* volume, const std::vector<G4int>& copynumbers) {
+    if (!volume) return;
+    m_layerVolumes[volume] = copynumbers;
+}
+
+void ScintillatorLayerManager::ClearLayerVolumes() {
+    m_layerVolumes.clear();
+}
+
+// 由touchable查找所在层的copynumber
+G4int ScintillatorLayerManager::GetLayerCopynumber(const G4VTouchable* touchable) const {
+    for (G4int depth = 0; depth < touchable->GetHistoryDepth(); depth++) {
+        auto it = m_layerVolumes.find(touchable->GetVolume(depth));
+        if (it == m_layerVolumes.end()) continue;
+        const std::vector<G4int>& copynumbers = it->second;
+        if (copynumbers.size() == 1) return copynumbers[0];
+        G4int replica = touchable->GetReplicaNumber(depth);
+        return (replica >= 0 && replica < static_cast<G4int>(copynumbers.size())) ? copynumbers[replica] : -1;
+    }
+    return -1;
+}
+
 // 计算总高度
 void ScintillatorLayerManager::CalculateTotalHeight() {
     m_totalStackHeight = 0.0;
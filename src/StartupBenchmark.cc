@@ -0,0 +1,133 @@
+#include "StartupBenchmark.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "G4Element.hh"
+#include "G4Material.hh"
+#include "G4StateManager.hh"
+#include "G4Threading.hh"
+
+#include "PhysicsTableCache.hh"
+#include "utilities.hh"
+
+namespace
+{
+    // 近似为程序启动的时刻
+    const std::chrono::steady_clock::time_point kProgramStart = std::chrono::steady_clock::now();
+}
+
+std::mutex StartupBenchmark::fMutex;
+std::vector<std::pair<G4String, G4double>> StartupBenchmark::fPhases;
+G4double StartupBenchmark::fMasterRunStart = -1;
+G4double StartupBenchmark::fWorkerRunStart = -1;
+G4int StartupBenchmark::fWorkers = 0;
+G4long StartupBenchmark::fInitMemory = -1;
+G4long StartupBenchmark::fPhysicsMemory = -1;
+G4bool StartupBenchmark::fReported = false;
+
+StartupBenchmark::StartupBenchmark()
+    : G4VStateDependent(), fInitPhase(0)
+{
+    fTimer.Start();
+}
+
+G4bool StartupBenchmark::Notify(G4ApplicationState requestedState)
+{
+    G4ApplicationState previousState = G4StateManager::GetStateManager()->GetCurrentState();
+
+    // 第二次进入Init是首次beamOn时的RunInitialization，物理表在此阶段建立
+    if (requestedState == G4State_Init && previousState == G4State_Idle && fInitPhase == 1) {
+        fTimer.Start();
+    }
+    else if (requestedState == G4State_Idle && previousState == G4State_Init) {
+        fTimer.Stop();
+        if (fInitPhase == 0) {
+            RecordPhase("Initialization", fTimer.GetRealElapsed());
+            fInitMemory = GetResidentMemory();
+            fInitPhase = 1;
+        }
+        else if (fInitPhase == 1) {
+            RecordPhase("Physics tables", fTimer.GetRealElapsed());
+            fPhysicsMemory = GetResidentMemory();
+            fInitPhase = 2;
+        }
+    }
+    return true;
+}
+
+void StartupBenchmark::RecordPhase(const G4String& phase, G4double seconds)
+{
+    std::lock_guard<std::mutex> lock(fMutex);
+    for (auto& entry : fPhases) {
+        if (entry.first == phase) {
+            entry.second = std::max(entry.second, seconds);
+            return;
+        }
+    }
+    fPhases.emplace_back(phase, seconds);
+}
+
+void StartupBenchmark::MarkRunStart()
+{
+    static G4ThreadLocal G4bool started = false;
+    if (started) return;
+    started = true;
+
+    G4double now = Elapsed();
+    std::lock_guard<std::mutex> lock(fMutex);
+    if (G4Threading::IsWorkerThread()) {
+        fWorkerRunStart = std::max(fWorkerRunStart, now);
+        fWorkers++;
+    }
+    else {
+        fMasterRunStart = now;
+    }
+}
+
+G4double StartupBenchmark::Elapsed()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - kProgramStart).count();
+}
+
+G4long StartupBenchmark::GetResidentMemory()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0) {
+            std::istringstream value(line.substr(6));
+            G4long kB = -1;
+            value >> kB;
+            return kB;
+        }
+    }
+    return -1;
+}
+
+void StartupBenchmark::ReportTimeline()
+{
+    std::lock_guard<std::mutex> lock(fMutex);
+    if (fReported || fMasterRunStart < 0) return;
+    fReported = true;
+
+    // 初始化一项包含几何、材料、重叠检查和（顺序模式下的）灵敏探测器构建
+    myPrint(INFO, "========== Startup timeline ==========");
+    for (const auto& entry : fPhases) {
+        G4String note;
+        if (entry.first == "Initialization") note = f(", RSS %ld kB", fInitMemory);
+        else if (entry.first == "Physics tables")
+            note = f(", RSS %ld kB (cache %s)", fPhysicsMemory, PhysicsTableCache::GetStatusName());
+        myPrint(INFO, f("%-20s %8.3f s%s", (entry.first + ":").c_str(), entry.second, note.c_str()));
+    }
+    if (fWorkers > 0) {
+        myPrint(INFO, f("%-20s %8.3f s (%d threads)", "Worker spin-up:", fWorkerRunStart - fMasterRunStart, fWorkers));
+    }
+    myPrint(INFO, f("%-20s %8.3f s", "First run started:", std::max(fMasterRunStart, fWorkerRunStart)));
+    myPrint(INFO, fmt("Elements / materials: {} / {}",
+                      G4Element::GetNumberOfElements(), G4Material::GetNumberOfMaterials()));
+    myPrint(INFO, "======================================");
+}
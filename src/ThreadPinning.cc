@@ -0,0 +1,155 @@
+#include "ThreadPinning.hh"
+#include "utilities.hh"
+
+#include "G4Exception.hh"
+#include "G4Threading.hh"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+G4String ThreadPinning::fPolicy = "none";
+std::mutex ThreadPinning::fMutex;
+std::vector<G4int> ThreadPinning::fCpus;
+std::map<G4int, G4int> ThreadPinning::fThreadCpu;
+
+namespace
+{
+  // /sys/devices/system/cpu/cpu<N>/topology/<name>，读不到时返回0
+  G4int ReadTopology(G4int cpu, const char* name)
+  {
+    std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" + name);
+    G4int value = 0;
+    file >> value;
+    return value;
+  }
+
+  // 解析核列表，如 0,2,4-7
+  std::vector<G4int> ParseCpuList(const G4String& list)
+  {
+    std::vector<G4int> cpus;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+      if (item.empty()) continue;
+      size_t dash = item.find('-');
+      G4int first = std::stoi(item.substr(0, dash));
+      G4int last = (dash == std::string::npos) ? first : std::stoi(item.substr(dash + 1));
+      for (G4int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+    }
+    return cpus;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void ThreadPinning::SetPolicy(const G4String& policy)
+{
+  if (policy != "none" && policy != "compact" && policy != "scatter") {
+    try {
+      if (ParseCpuList(policy).empty()) throw std::invalid_argument(policy);
+    }
+    catch (const std::exception&) {
+      G4ExceptionDescription ed;
+      ed << "Invalid thread pinning policy \"" << policy << "\", use none, compact, scatter or a list like 0,2,4-7";
+      G4Exception("ThreadPinning::SetPolicy", "InvalidPinPolicy", FatalException, ed);
+      return;
+    }
+  }
+  std::lock_guard<std::mutex> lock(fMutex);
+  fPolicy = policy;
+  fCpus.clear();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+std::vector<G4int> ThreadPinning::OrderedCpus()
+{
+  if (fPolicy != "compact" && fPolicy != "scatter") return ParseCpuList(fPolicy);
+
+  std::vector<G4int> allowed;
+#ifdef __linux__
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+    for (G4int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &mask)) allowed.push_back(cpu);
+    }
+  }
+#endif
+
+  // (插槽, 同一物理核上的第几个逻辑核, 物理核, 逻辑核)
+  std::vector<std::tuple<G4int, G4int, G4int, G4int>> topology;
+  std::map<std::pair<G4int, G4int>, G4int> siblings;
+  for (G4int cpu : allowed) {
+    G4int socket = ReadTopology(cpu, "physical_package_id");
+    G4int core = ReadTopology(cpu, "core_id");
+    topology.emplace_back(socket, siblings[{socket, core}]++, core, cpu);
+  }
+  // 先用完各物理核再使用超线程
+  std::sort(topology.begin(), topology.end());
+
+  std::vector<G4int> cpus;
+  if (fPolicy == "compact") {
+    for (const auto& entry : topology) cpus.push_back(std::get<3>(entry));
+    return cpus;
+  }
+
+  // scatter：各插槽轮流取一个核
+  std::map<G4int, std::vector<G4int>> sockets;
+  for (const auto& entry : topology) sockets[std::get<0>(entry)].push_back(std::get<3>(entry));
+  for (size_t i = 0; cpus.size() < topology.size(); i++) {
+    for (const auto& socket : sockets) {
+      if (i < socket.second.size()) cpus.push_back(socket.second[i]);
+    }
+  }
+  return cpus;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void ThreadPinning::PinCurrentThread()
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  if (fPolicy == "none") return;
+
+  if (fCpus.empty()) fCpus = OrderedCpus();
+  if (fCpus.empty()) return;
+
+  G4int threadId = G4Threading::G4GetThreadId();
+  G4int cpu = fCpus[std::max(threadId, 0) % fCpus.size()];
+#ifdef __linux__
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(cpu, &mask);
+  if (sched_setaffinity(0, sizeof(mask), &mask) != 0) {
+    myPrint(ERROR, f("Cannot pin thread %d to CPU %d", threadId, cpu));
+    return;
+  }
+  fThreadCpu[threadId] = cpu;
+#else
+  G4Exception("ThreadPinning::PinCurrentThread", "PinningUnsupported", JustWarning,
+              "Thread pinning is only supported on Linux");
+#endif
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void ThreadPinning::Report()
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  if (fThreadCpu.empty()) return;
+
+  std::stringstream ss;
+  for (const auto& entry : fThreadCpu) {
+    ss << " " << entry.first << "->" << entry.second
+       << "(s" << ReadTopology(entry.second, "physical_package_id") << ")";
+  }
+  G4cout << " Thread-to-core map (" << fPolicy << "):" << ss.str() << G4endl;
+}
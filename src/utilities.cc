@@ -1,8 +1,10 @@
 // utilities.cc
 #include "utilities.hh"
 #include "config.hh"
+#include "G4Threading.hh"
 #include <iostream>
 #include <sstream>
+#include <mutex>
 
 
 // 格式化字符串函数
@@ -15,16 +17,65 @@ std::string f(const char* format, ...) {
     return std::string(buffer);
 }
 
-// 打印日志函数
-void myPrint(LogLevel level, const std::string& message) {
-    if (level >= lv) {  // 只显示级别高于或等于全局设置的日志
-        std::string prefix;
-        switch(level) {
-            case DEBUG: prefix = "[DEBUG] "; break;
-            case INFO:  prefix = "[INFO] ";  break;
-            case ERROR: prefix = "[ERROR] "; break;
+namespace {
+    // 所有线程共享的输出锁，每次只在整块输出时加锁
+    std::mutex logOutputMutex;
+
+    const std::size_t kLogBufferSize = 4096;
+
+    // 线程局部的日志缓冲区，线程退出时自动输出剩余内容
+    struct LogBuffer {
+        std::string data;
+        ~LogBuffer() { Flush(); }
+        void Flush() {
+            if (data.empty()) return;
+            std::lock_guard<std::mutex> lock(logOutputMutex);
+            std::cout.write(data.data(), data.size());
+            std::cout.flush();
+            data.clear();
         }
-        std::cout << prefix << message << std::endl;
+    };
+
+    LogBuffer& GetLogBuffer() {
+        thread_local LogBuffer buffer;
+        return buffer;
     }
 }
 
+// 写入日志
+void LogMessage(LogLevel level, const std::string& message) {
+    LogBuffer& buffer = GetLogBuffer();
+    switch(level) {
+        case DEBUG: buffer.data += "[DEBUG] "; break;
+        case INFO:  buffer.data += "[INFO] ";  break;
+        case ERROR: buffer.data += "[ERROR] "; break;
+    }
+    // 工作线程的日志带线程号，便于区分成块输出的内容
+    if (G4Threading::IsWorkerThread()) {
+        buffer.data += "[T" + std::to_string(G4Threading::G4GetThreadId()) + "] ";
+    }
+    buffer.data += message;
+    buffer.data += '\n';
+
+    // 主线程（交互界面）和错误信息立即输出，工作线程攒满一块再输出
+    if (level == ERROR || !G4Threading::IsWorkerThread() || buffer.data.size() >= kLogBufferSize) {
+        buffer.Flush();
+    }
+}
+
+void FlushLog() {
+    GetLogBuffer().Flush();
+}
+
+// 初始化日志级别
+void InitializeLogLevel() {
+    lv = g_debug_mode ? DEBUG : INFO;
+}
+
+std::uint64_t HashBytes(const std::string& data, std::uint64_t hash) {
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}